@@ -24,6 +24,17 @@
 #include <thread>
 #include <fstream>
 #include <queue>
+#include <deque>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <tuple>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
 
 #define NOMINMAX 1
 #define WINVER 0x0601
@@ -45,6 +56,9 @@
 namespace resource {
 #include "resource/background.h"
 #include "resource/compass.h"
+#include "resource/cull_comp.h"
+#include "resource/expand_comp.h"
+#include "resource/heatmap_frag.h"
 #include "resource/help.h"
 #include "resource/icon_16.h"
 #include "resource/icon_32.h"
@@ -53,9 +67,22 @@ namespace resource {
 #include "resource/shader_frag.h"
 #include "resource/shader_vert.h"
 #include "resource/texture.h"
+#include "resource/tile_frag.h"
+#include "resource/tile_vert.h"
 }
 
 #define OPENGL_SHADER_TESTS 1
+// Keeps linked programs under %LOCALAPPDATA% so later launches skip compiling
+#define PROGRAM_CACHE 1
+#define ROUTE_STATISTICS 0
+#define RENDER_STATISTICS 0
+// Frames per second while something animates, a vsync slower than this paces the loop instead
+#define FRAME_RATE 60
+#define VSYNC 1
+// Times the stages of a frame on the GPU and CPU, F3 shows them, see 'render_profiler'
+#define FRAME_PROFILER 1
+// Writes the profiler's timings to 'profile.csv' while it is shown
+#define PROFILER_CSV 0
 
 struct __global_type {
     // Windows application instance
@@ -72,17 +99,20 @@ struct __global_type {
     bool redraw = true;
     // If true discard the incoming update and render
     bool discard = false;
-    // Global scale for the window
+    // Global scale for the window, the content scale of its monitor rounded to a whole multiple
     unsigned global_scale = 1;
-    // Queues an update
-    bool queue_update = false;
     // If true display the help image
     bool show_help = false;
     
     struct __window {
         GLFWwindow* handle = nullptr;
         HWND hwnd = nullptr;
+        // Framebuffer size in pixels
         glm::uvec2 size { 600, 600 };
+        // Size and content scale reported since the last frame, a resize drag reports many and only the last is applied
+        glm::uvec2 pending_size { 0, 0 };
+        float pending_scale = 0;
+        bool resized = false;
         
         struct __icons {
             bitmap icon_64;
@@ -98,6 +128,12 @@ struct __global_type {
                 GLuint quad_vertices_id = 0;
                 GLuint quad_indices_id = 0;
                 GLuint quad_instanced_pos_id = 0;
+                GLuint map_instances_id = 0;
+                GLuint draw_commands_id = 0;
+                GLuint sprite_table_id = 0;
+                GLuint room_positions_id = 0;
+                // Fragments drawn in each frame in flight, see 'render_overdraw'
+                GLuint overdraw_counter_id = 0;
                 
                 GLuint screen_info_id = 0;
                 GLuint translation_id = 0;
@@ -110,53 +146,294 @@ struct __global_type {
                 GLuint uv_id = 0;
                 // Instanced
                 GLuint position_id = 0;
-                GLuint size_id = 0;
-                GLuint uv_position_id = 0;
-                GLuint uv_size_id = 0;
+                GLuint sprite_id = 0;
                 GLuint uv_tr_id = 0;
             } rect_attribs;
-            struct __uniforms {
-                GLint border_fade_id = 0;
-            } uniforms;
             struct __uniform_buffers {
                 const GLuint screen_info_index = 0;
                 const GLuint translation_info_index = 1;
+                const GLuint sprite_table_index = 2;
             } uniform_buffers;
+            // Variant without any instance flags
             GLuint program = 0;
+            // Variants of 'program' by the instance flags they are compiled for, see 'variant_program'
+            std::map<unsigned, GLuint> variants;
+            // Uniforms every variant is given, one layer scale per 'texture_layer'
+            glm::vec2 layer_scale[4] { };
+            unsigned linear_layers = 0;
+            glm::vec4 minimap_area { 0 };
+            // Draws the map from the room state texture in one pass
+            GLuint tile_program = 0;
+            // Expands the room state texture into the map instance slots
+            GLuint expand_program = 0;
+            // Compacts the map instances in view into the frame's stream
+            GLuint cull_program = 0;
+            // Shows the fragments drawn to each pixel as colors
+            GLuint heatmap_program = 0;
         } shader;
+        struct __ring {
+            // Persistently mapped instance storage, split into one region per frame in flight
+            rect_instance* mapped = nullptr;
+            // Instances each region holds
+            unsigned region_size = 0;
+            // Region written this frame and the next free instance in it
+            unsigned region = 0;
+            unsigned head = 0;
+            // Signaled when the GPU is done with the frame written to each region
+            GLsync fences[3] { };
+            // Persistently mapped draw commands, one region per frame like the instances
+            draw_command* commands = nullptr;
+            // Next free command and the first one not yet submitted
+            unsigned command_head = 0;
+            unsigned command_first = 0;
+            // Instance flags of each command this frame, selects the variant it is drawn with
+            unsigned command_flags[64] { };
+        } ring;
+        struct __frame {
+            // Layer and flags given to every instance drawn until changed
+            texture_layer layer = texture_layer::texture;
+            unsigned flags = 0;
+            
+            unsigned draws = 0;
+            unsigned draw_calls = 0;
+            unsigned state_changes = 0;
+        } frame;
+        struct __cull {
+            // Command of the culled map draw in each region, its instance count is written by the GPU, -1 without one
+            int commands[3] { -1, -1, -1 };
+            unsigned submitted[3] { };
+            // Rooms tested and instances kept in the last culled frame read back
+            unsigned rooms = 0;
+            unsigned visible = 0;
+        } cull;
+        struct __sprites {
+            // Every distinct size, texture area and layer drawn so far by its index in the sprite table
+            std::map<std::tuple<glm::uint, glm::uint, float, float, float, float, texture_layer>, std::uint16_t> index;
+        } sprites;
         struct __textures {
-            GLuint texture_id = 0;
-            GLuint background_id = 0;
-            GLuint compass_id = 0;
-            GLuint help_id = 0;
+            // Every image as one layer, see 'texture_layer'
+            GLuint array_id = 0;
+            // One byte per grid cell, see 'room_state'
+            GLuint room_state_id = 0;
+            // One texel per grid cell colored like the room, its mipmaps are thumbnails of ever larger chunks of rooms
+            GLuint map_overview_id = 0;
+            // The map drawn ahead of time, see 'render_map_cache'
+            GLuint map_cache_id = 0;
+            // Every frame is drawn here and kept so a later one can redraw only what changed
+            GLuint frame_id = 0;
+            // Fragments drawn to each pixel of the frame, same size as the frame texture
+            GLuint overdraw_id = 0;
         } textures;
+        struct __framebuffers {
+            GLuint map_cache_id = 0;
+            GLuint frame_id = 0;
+        } framebuffers;
+        struct __state {
+            // What was last given to GL, calls that would not change it are skipped, everything binds through here
+            std::map<GLenum, GLuint> buffers;
+            std::map<std::pair<GLuint, GLenum>, GLuint> textures;
+            GLuint active_unit = 0;
+            GLuint program = 0;
+            GLuint read_framebuffer = 0;
+            GLuint draw_framebuffer = 0;
+            // Uniform buffer contents, written once before the next draw or dispatch if they changed
+            translation_info translation;
+            screen_info screen;
+            translation_info uploaded_translation;
+            screen_info uploaded_screen;
+            
+            unsigned elided = 0;
+            unsigned uniform_writes = 0;
+            unsigned uniform_uploads = 0;
+        } state;
+        struct __damage {
+            // Size the frame texture is allocated with, at least the window size
+            glm::uvec2 capacity { 0, 0 };
+            // Window area changed by updates that need no full redraw, top left and bottom right in window pixels
+            glm::ivec2 low { 0, 0 };
+            glm::ivec2 high { 0, 0 };
+            bool pending = false;
+            // If the frame texture holds a complete frame
+            bool valid = false;
+            // If the current frame only redraws the damaged area
+            bool partial = false;
+        } damage;
+        struct __overdraw {
+            // Shown with F4 instead of the frame
+            bool enabled = false;
+            // If the frame last drawn with each region counted its fragments
+            bool counted[3] { };
+            // Fragments of the last counted frame read back
+            GLuint fragments = 0;
+        } overdraw;
+        struct __samplers {
+            GLuint nearest_id = 0;
+            GLuint linear_id = 0;
+        } samplers;
+        struct __program_cache {
+            // Where program binaries are kept, empty if the driver offers no binary format
+            std::filesystem::path directory;
+            // Hash of the driver's vendor, renderer and version, binaries from any other driver are not tried
+            std::uint64_t driver = 0;
+            // Programs loaded and compiled so far and the milliseconds spent on both
+            unsigned loaded = 0;
+            unsigned compiled = 0;
+            double time = 0;
+        } program_cache;
     } opengl;
     
+    struct __profiler {
+        bool enabled = false;
+        // One elapsed time query per GPU stage for each frame in flight, read back once available so nothing waits on the GPU
+        GLuint queries[4][6] { };
+        // Stages begun in each frame, one bit per stage, and the stage running now or -1
+        unsigned begun[4] { };
+        unsigned frame = 0;
+        int stage = -1;
+        // Last milliseconds of every timer by 'profile_timer', the GPU stages arrive a few frames late
+        float samples[10][64] { };
+        unsigned next[10] { };
+        // Samples taken of every timer up to the buffer size, a stage that did not run in a frame takes none
+        unsigned taken[10] { };
+        // CPU time spent on each timer since the last frame
+        double pending[10] { };
+        std::ofstream csv;
+    } profiler;
+    
     struct __map {
-        // Current player position in the map
-        glm::ivec2 position { 0, 0 };
+        // Every player on the map, the arrow keys move the active one
+        std::vector<player_data> players = std::vector<player_data>(1);
+        unsigned active_player = 0;
         // Current view position
         glm::ivec2 view_position { 0, 0 };
         // The targeted view position
         glm::ivec2 target_view_position { 0, 0 };
         
+        // The targeted view scale, the global scale times the zoom level
+        float target_view_scale = 1;
+        
+        struct __camera {
+            // Where the current move started, where it goes and when it started in seconds
+            glm::vec2 start { 0, 0 };
+            glm::ivec2 target { 0, 0 };
+            float start_scale = 1;
+            float target_scale = 1;
+            double start_time = 0;
+            // Where the view is now, the shaders place it themselves so this is only followed for input and damage
+            glm::vec2 position { 0, 0 };
+            float scale = 1;
+            // If the view has not reached the target yet
+            bool moving = false;
+        } camera;
+        
         bool view_portal_room = false;
         bool show_scale_meter = false;
         
-        glm::uint scale = 6;
+        // Zoom level, see 'zoom_scale'
+        glm::uint scale = 9;
         
         std::map<point_id_t, room_data> rooms;
         
         bool pick_direction = true;
         
-        std::pair<glm::ivec2, path_flag> path[10] { { { 0, 0 }, (path_flag) 0 } };
-        unsigned path_head = 0;
-        unsigned path_size = 0;
-        
-        std::vector<glm::ivec2> portal_path;
+        struct __landmarks {
+            // Rooms the distance tables are measured from, the portal room is always first
+            std::vector<glm::ivec2> positions;
+            // Hop distances from each landmark to every cell of the map indexed by point id
+            std::vector<std::vector<std::uint16_t>> distances;
+            // Room count when the landmarks were last chosen
+            size_t chosen_room_count = 0;
+            // If the tables may overestimate a route and need to be rebuilt
+            bool stale = true;
+        } landmarks;
+        
+        struct __corridors {
+            // Rooms that are not part of a two door corridor and the corridors leaving them
+            std::map<point_id_t, std::vector<corridor_edge>> junctions;
+            // Rooms inside a corridor and the junctions at both ends
+            std::map<point_id_t, std::pair<point_id_t, point_id_t>> interior;
+            // Rooms changed since the corridors were last updated
+            std::set<point_id_t> dirty;
+        } corridors;
+        
+        struct __speculation {
+            // Portal routes computed ahead of time for each move out of the current room
+            struct __move {
+                glm::ivec2 position { 0, 0 };
+                std::vector<glm::ivec2> route;
+                bool ready = false;
+            } moves[4];
+            // Position the moves lead out of
+            glm::ivec2 origin { 0, 0 };
+            // Next move to compute, all are done at 4
+            unsigned next = 4;
+            
+            unsigned hits = 0;
+            unsigned misses = 0;
+        } speculation;
+        
+        // Room picked with the mouse and the route to it from the current position
+        glm::ivec2 route_target { 0, 0 };
+        bool has_route_target = false;
+        std::vector<glm::ivec2> target_path;
+        
+        struct __route_table {
+            // Every junction of the corridor graph by slot, a slot stays with its junction until it is removed
+            std::vector<point_id_t> junctions;
+            std::map<point_id_t, unsigned> index;
+            // Slots left by removed junctions for the next new ones
+            std::vector<unsigned> free;
+            // Cheapest corridor between each pair of neighboring junctions by slot
+            std::vector<std::map<unsigned, unsigned>> edges;
+            // Route cost between every pair of slots, row major
+            std::vector<unsigned> costs;
+            // Junctions with doors no corridor follows and the cells behind them
+            std::vector<std::pair<unsigned, point_id_t>> exits;
+            // If the corridors changed since the table was last updated
+            bool stale = true;
+        } route_table;
+        
+        struct __layer {
+            // First instance slot owned by each room
+            std::map<point_id_t, unsigned> slots;
+            // Position of the room owning each slot, mirrored in the room position buffer
+            std::vector<glm::ivec2> positions;
+            // Rooms whose instances need to be expanded again
+            std::set<point_id_t> dirty;
+            // Rooms the map instance buffer has storage for
+            unsigned capacity = 0;
+        } layer;
+        
+        // Draw the map with the tile renderer instead of room instances
+        bool tile_renderer = false;
+        struct __tiles {
+            // Rooms whose byte in the room state texture is out of date
+            std::set<point_id_t> dirty;
+            // If the whole texture needs to be cleared first
+            bool clear = true;
+            // If the overview's smaller levels are behind its rooms, they are rebuilt before it is next sampled
+            bool overview_mips = false;
+        } tiles;
+        
+        struct __minimap {
+            // Grid cells every room lies within
+            glm::ivec2 low { 0, 0 };
+            glm::ivec2 high { 0, 0 };
+            bool empty = true;
+            // If the shown area needs to be updated
+            bool stale = true;
+        } minimap;
+        
+        struct __cache {
+            // Map position of the top left of the map cache and the size of its texture
+            glm::ivec2 origin { 0, 0 };
+            glm::uvec2 size { 0, 0 };
+            // If the map changed since it was last drawn into the cache
+            bool stale = true;
+        } cache;
     } map;
     
-    std::set<DWORD> global_keys { VK_DOWN, VK_UP, VK_LEFT, VK_RIGHT, VK_HOME, VK_END, VK_PRIOR, VK_NEXT };
+    std::set<DWORD> global_keys { VK_DOWN, VK_UP, VK_LEFT, VK_RIGHT, VK_HOME, VK_END, VK_PRIOR, VK_NEXT, VK_INSERT, VK_DELETE };
 } static global_state;
 
 namespace constants {
@@ -169,6 +446,10 @@ namespace constants {
     template<typename _Tp>
     inline constexpr glm::vec<2, _Tp, glm::defaultp> east { 1, 0 };
     
+    // Order matches 'path_flag'
+    template<typename _Tp>
+    inline constexpr glm::vec<2, _Tp, glm::defaultp> directions[] { south<_Tp>, east<_Tp>, north<_Tp>, west<_Tp> };
+    
     template<typename _Tp>
     inline constexpr glm::vec<2, _Tp, glm::defaultp> zero { 0, 0 };
     template<typename _Tp>
@@ -176,6 +457,22 @@ namespace constants {
     
     namespace window {
         constexpr unsigned icon_count = sizeof(__global_type::__window::__icons) / sizeof(bitmap);
+        // Smallest window the compass still fits in
+        constexpr int min_size = 320;
+        // Steps the frame texture grows in, a resize drag rarely needs a new one
+        constexpr unsigned frame_step = 256;
+    }
+    
+    namespace profiler {
+        constexpr unsigned frames = sizeof(__global_type::__profiler::begun) / sizeof(unsigned);
+        constexpr unsigned stages = sizeof(__global_type::__profiler::queries[0]) / sizeof(GLuint);
+        constexpr unsigned timers = sizeof(__global_type::__profiler::next) / sizeof(unsigned);
+        constexpr unsigned samples = sizeof(__global_type::__profiler::samples[0]) / sizeof(float);
+        // Bar length of a millisecond and of a row in window pixels
+        constexpr float pixels_per_ms = 16;
+        constexpr int row_height = 6;
+        // Column names of the CSV file, order matches 'profile_timer'
+        inline const char* names[] { "background", "map", "paths", "markers", "overlays", "present", "update", "map_instances", "find_path", "render" };
     }
     
     namespace opengl {
@@ -185,6 +482,32 @@ namespace constants {
             constexpr GLuint rect_attribs_count = sizeof(__global_type::__opengl::__shader::__rect_attribs) / sizeof(GLuint);
         }
         constexpr GLuint textures_count = sizeof(__global_type::__opengl::__textures) / sizeof(GLuint);
+        constexpr GLuint samplers_count = sizeof(__global_type::__opengl::__samplers) / sizeof(GLuint);
+        constexpr GLuint framebuffers_count = sizeof(__global_type::__opengl::__framebuffers) / sizeof(GLuint);
+        constexpr GLuint layers_count = sizeof(__global_type::__opengl::__shader::layer_scale) / sizeof(glm::vec2);
+        
+        namespace ring {
+            constexpr unsigned regions = sizeof(__global_type::__opengl::__ring::fences) / sizeof(GLsync);
+            constexpr unsigned region_size = 4096;
+            constexpr unsigned region_commands = sizeof(__global_type::__opengl::__ring::command_flags) / sizeof(unsigned);
+        }
+        
+        // Entries of the sprite table, fills the 16KiB every implementation allows for a uniform block
+        constexpr unsigned sprite_count = 512;
+        // Sprite size the vertex shader replaces with the screen size, see 'screen_rect'
+        constexpr glm::uvec2 screen_size { 0xFFFFFFFF, 0xFFFFFFFF };
+        
+        namespace instance {
+            constexpr unsigned translated = 0x1;
+            constexpr unsigned border_fade = 0x2;
+            // Sampled from the map cache or the map overview instead of the texture array
+            constexpr unsigned map_cache = 0x4;
+            constexpr unsigned map_overview = 0x8;
+            // Only the explored area of the map overview, see 'update_minimap'
+            constexpr unsigned minimap = 0x10;
+            // Never set on instances, added to every draw to the frame while the overdraw is shown
+            constexpr unsigned overdraw = 0x20;
+        }
     }
     
     namespace map {
@@ -192,11 +515,43 @@ namespace constants {
         inline constexpr _Tp radius = 200;
         
         inline constexpr unsigned min_scale = 1;
-        inline constexpr unsigned max_scale = 8;
+        inline constexpr unsigned max_scale = 11;
+        // Zoom levels below a scale of one, each halves the scale
+        inline constexpr unsigned zoom_out_levels = 3;
+        // Scales below this draw the map overview instead of rooms
+        inline constexpr float overview_scale = 0.5f;
+        
+        // Side of the minimap in window pixels and the fewest cells it shows across
+        inline constexpr unsigned minimap_size = 128;
+        inline constexpr int minimap_min_cells = 8;
         
         inline constexpr unsigned path_count = 10;
         
+        inline constexpr unsigned player_count = 8;
+        
         inline constexpr unsigned room_area = 40;
+        
+        inline constexpr unsigned size = radius<unsigned> * 2 + 1;
+        inline constexpr unsigned cell_count = size * size;
+        
+        inline constexpr unsigned route_length = 64;
+        
+        inline constexpr unsigned landmark_count = 4;
+        inline constexpr std::uint16_t landmark_unreachable = 0xFFFF;
+        
+        inline constexpr unsigned route_unreachable = 0xFFFFFFFF;
+        
+        // Room, marker, the south and east paths and the north and west path ends
+        inline constexpr unsigned room_slots = 6;
+        
+        // Room extent past its grid point with the door stubs, and the space left around the rooms in the map cache
+        // so the border fade the map instances carry never reaches them there
+        inline constexpr int room_extent = 24;
+        inline constexpr int cache_margin = 40;
+        inline constexpr unsigned cache_min_size = 256;
+        
+        // Seconds a view move takes
+        inline constexpr double camera_duration = 0.3;
     }
     
     quad_vertex const quad_vertices[] {
@@ -269,19 +624,134 @@ namespace __detail {
     }
 }
 
+inline player_data&
+active_player( ) {
+    return global_state.map.players[global_state.map.active_player];
+}
+
+inline std::chrono::steady_clock::time_point
+profile_clock( ) {
+    return std::chrono::steady_clock::now( );
+}
+void
+profile_sample(profile_timer timer, float time) {
+    auto& profiler = global_state.profiler;
+    auto i = (unsigned) timer;
+    profiler.samples[i][profiler.next[i]] = time;
+    profiler.next[i] = (profiler.next[i] + 1) % constants::profiler::samples;
+    profiler.taken[i] = std::min(profiler.taken[i] + 1, constants::profiler::samples);
+}
+void
+profile_cpu(profile_timer timer, std::chrono::steady_clock::time_point begin) {
+#if FRAME_PROFILER
+    if(!global_state.profiler.enabled) return;
+    global_state.profiler.pending[(unsigned) timer] += std::chrono::duration<double, std::milli>(profile_clock( ) - begin).count( );
+#endif
+}
+
 inline constexpr point_id_t
 point_id(const glm::ivec2& p) {
-    constexpr unsigned size = constants::map::radius<unsigned> * 2 + 1;
+    constexpr unsigned size = constants::map::size;
     constexpr unsigned offset = constants::map::radius<unsigned>;
     return (point_id_t) ((p.x + offset) + (p.y + offset) * size);
 }
+inline bool
+in_map(const glm::ivec2& p) {
+    return std::abs(p.x) <= constants::map::radius<int> && std::abs(p.y) <= constants::map::radius<int>;
+}
+inline constexpr glm::ivec2
+point_position(point_id_t point) {
+    constexpr int offset = constants::map::radius<int>;
+    return { (int) ((unsigned) point % constants::map::size) - offset, (int) ((unsigned) point / constants::map::size) - offset };
+}
+
+void
+bind_buffer(GLenum target, GLuint buffer) {
+    auto& state = global_state.opengl.state;
+    GLuint& bound = state.buffers[target];
+    if(bound == buffer) {
+        state.elided++;
+        return;
+    }
+    glBindBuffer(target, buffer);
+    bound = buffer;
+}
+void
+forget_buffer(GLuint buffer) {
+    // Deleting a buffer unbinds it and its name may be given out again
+    for(auto& [target, bound]: global_state.opengl.state.buffers)
+        if(bound == buffer) bound = 0;
+}
+void
+bind_texture(GLuint unit, GLenum target, GLuint texture) {
+    auto& state = global_state.opengl.state;
+    // The unit is selected even when the texture is already bound, calls after this one act on it
+    if(state.active_unit != unit) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        state.active_unit = unit;
+    } else state.elided++;
+    
+    GLuint& bound = state.textures[{ unit, target }];
+    if(bound == texture) {
+        state.elided++;
+        return;
+    }
+    glBindTexture(target, texture);
+    bound = texture;
+}
+void
+use_program(GLuint program) {
+    auto& state = global_state.opengl.state;
+    if(state.program == program) {
+        state.elided++;
+        return;
+    }
+    glUseProgram(program);
+    state.program = program;
+}
+void
+bind_framebuffer(GLenum target, GLuint framebuffer) {
+    auto& state = global_state.opengl.state;
+    bool read = target != GL_DRAW_FRAMEBUFFER;
+    bool draw = target != GL_READ_FRAMEBUFFER;
+    if((!read || state.read_framebuffer == framebuffer) && (!draw || state.draw_framebuffer == framebuffer)) {
+        state.elided++;
+        return;
+    }
+    glBindFramebuffer(target, framebuffer);
+    if(read) state.read_framebuffer = framebuffer;
+    if(draw) state.draw_framebuffer = framebuffer;
+}
+void
+flush_uniforms( ) {
+    auto& state = global_state.opengl.state;
+    if(std::memcmp(&state.translation, &state.uploaded_translation, sizeof(translation_info)) != 0) {
+        bind_buffer(GL_UNIFORM_BUFFER, global_state.opengl.shader.buffers.translation_id);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(translation_info), &state.translation);
+        state.uploaded_translation = state.translation;
+        state.uniform_uploads++;
+    }
+    if(state.screen.size != state.uploaded_screen.size) {
+        bind_buffer(GL_UNIFORM_BUFFER, global_state.opengl.shader.buffers.screen_info_id);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(screen_info), &state.screen);
+        state.uploaded_screen = state.screen;
+        state.uniform_uploads++;
+    }
+}
+void
+update_variant_uniforms(GLuint program) {
+    auto& shader = global_state.opengl.shader;
+    glProgramUniform2fv(program, glGetUniformLocation(program, "layer_scale"), (GLsizei) std::size(shader.layer_scale), (GLfloat*) shader.layer_scale);
+    glProgramUniform1ui(program, glGetUniformLocation(program, "linear_layers"), shader.linear_layers);
+    glProgramUniform4fv(program, glGetUniformLocation(program, "minimap_area"), 1, (GLfloat*) &shader.minimap_area);
+}
 
 template<bool unbind = true>
 void
 assign_buffer(GLenum target, GLuint buffer, GLuint size, const void* data, GLenum usage = GL_STATIC_DRAW) {
-    glBindBuffer(target, buffer);
+    bind_buffer(target, buffer);
     glBufferData(target, size, data, usage);
-    if(unbind) glBindBuffer(target, 0);
+    if(unbind) bind_buffer(target, 0);
 }
 GLuint
 load_shader(const std::vector<std::string>& shader, GLenum shader_type) {
@@ -313,21 +783,34 @@ load_shader(const std::vector<std::string>& shader, GLenum shader_type) {
     return shader_id;
 }
 GLuint
-load_image(const bitmap& map, GLenum filter = GL_NEAREST, GLenum wrap = GL_CLAMP) {
-    if(!map.allocated) return 0;
+load_image_array(const std::vector<bitmap>& maps) {
+    glm::uvec2 size { 0 };
+    for(const auto& map: maps) {
+        if(!map.allocated) return 0;
+        size = glm::max(size, map.size);
+    }
+    
     GLuint id = 0;
     glGenTextures(1, &id);
     if(id == 0) throw std::runtime_error("Unable to allocated image on graphics pipeline");
     
-    glBindTexture(GL_TEXTURE_2D, id);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, (GLint) map.size.x, (GLint) map.size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, map.bytes);
-    
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, (GLint) wrap);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, (GLint) wrap);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, (GLint) filter);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (GLint) filter);
+    // Each image sits in the corner of its layer, the shader scales the coordinates to its area
+    bind_texture(0, GL_TEXTURE_2D_ARRAY, id);
+    glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_RGBA8, (GLsizei) size.x, (GLsizei) size.y, (GLsizei) maps.size( ));
+    for(size_t i = 0; i < maps.size( ); i++)
+        glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, (GLint) i, (GLsizei) maps[i].size.x, (GLsizei) maps[i].size.y, 1, GL_RGBA, GL_UNSIGNED_BYTE, maps[i].bytes);
     
-    glBindTexture(GL_TEXTURE_2D, 0);
+    bind_texture(0, GL_TEXTURE_2D_ARRAY, 0);
+    return id;
+}
+GLuint
+load_sampler(GLenum filter) {
+    GLuint id = 0;
+    glGenSamplers(1, &id);
+    glSamplerParameteri(id, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glSamplerParameteri(id, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glSamplerParameteri(id, GL_TEXTURE_MAG_FILTER, (GLint) filter);
+    glSamplerParameteri(id, GL_TEXTURE_MIN_FILTER, (GLint) filter);
     return id;
 }
 
@@ -384,17 +867,21 @@ create_window( ) {
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
     
     glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    glfwWindowHint(GLFW_SCALE_TO_MONITOR, GLFW_TRUE);
     
     GLFWmonitor* monitor = glfwGetPrimaryMonitor( );
     GLFWwindow* window_ref = glfwCreateWindow((int) global_state.window.size.x, (int) global_state.window.size.y, "Vault Mapper", nullptr, nullptr);
     if(window_ref == nullptr) throw std::runtime_error("Failed to create window.");
     glfwSetWindowAttrib(window_ref, GLFW_AUTO_ICONIFY, false);
-    glfwSetWindowAttrib(window_ref, GLFW_RESIZABLE, false);
+    glfwSetWindowAttrib(window_ref, GLFW_RESIZABLE, true);
+    glfwSetWindowSizeLimits(window_ref, constants::window::min_size, constants::window::min_size, GLFW_DONT_CARE, GLFW_DONT_CARE);
     glfwSetWindowAttrib(window_ref, GLFW_DECORATED, true);
     glfwSetWindowAttrib(window_ref, GLFW_FLOATING, false);
     
     const GLFWvidmode* videoMode = glfwGetVideoMode(monitor);
-    glfwSetWindowPos(window_ref, (int) (videoMode->width - global_state.window.size.x) / 2, (int) (videoMode->height - global_state.window.size.y) / 2);
+    int width, height;
+    glfwGetWindowSize(window_ref, &width, &height);
+    glfwSetWindowPos(window_ref, (videoMode->width - width) / 2, (videoMode->height - height) / 2);
     return window_ref;
 }
 void
@@ -414,68 +901,377 @@ window_icons( ) {
     glfwSetWindowIcon(global_state.window.handle, (int) constants::window::icon_count, (GLFWimage*) &icons);
 }
 void
+build_frame_target( ) {
+    // The window only uses the bottom left of the texture, it is replaced once the window outgrows it
+    auto& damage = global_state.opengl.damage;
+    damage.valid = false;
+    if(global_state.window.size.x <= damage.capacity.x && global_state.window.size.y <= damage.capacity.y) return;
+    constexpr unsigned step = constants::window::frame_step;
+    damage.capacity = (glm::max(global_state.window.size, damage.capacity) + (step - 1)) / step * step;
+    
+    bind_texture(0, GL_TEXTURE_2D, global_state.opengl.textures.frame_id);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, (GLsizei) damage.capacity.x, (GLsizei) damage.capacity.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    bind_texture(0, GL_TEXTURE_2D, 0);
+    
+    bind_framebuffer(GL_FRAMEBUFFER, global_state.opengl.framebuffers.frame_id);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, global_state.opengl.textures.frame_id, 0);
+    if(glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) throw std::runtime_error("Frame framebuffer is incomplete");
+    bind_framebuffer(GL_FRAMEBUFFER, 0);
+    
+    // Stays bound to image unit 0, only the overdraw variants and the heatmap use it
+    bind_texture(0, GL_TEXTURE_2D, global_state.opengl.textures.overdraw_id);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R32UI, (GLsizei) damage.capacity.x, (GLsizei) damage.capacity.y, 0, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    bind_texture(0, GL_TEXTURE_2D, 0);
+    glBindImageTexture(0, global_state.opengl.textures.overdraw_id, 0, GL_FALSE, 0, GL_READ_WRITE, GL_R32UI);
+}
+void
 build_gl_images( ) {
-    bitmap texture_bitmap = load_image(resource::texture, sizeof(resource::texture));
-    global_state.opengl.textures.texture_id = load_image(texture_bitmap);
-    delete_image(texture_bitmap);
-    
-    bitmap background_bitmap = load_image(resource::background, sizeof(resource::background));
-    global_state.opengl.textures.background_id = load_image(background_bitmap, GL_LINEAR, GL_REPEAT);
-    delete_image(background_bitmap);
-    
-    bitmap compass_bitmap = load_image(resource::compass, sizeof(resource::compass));
-    global_state.opengl.textures.compass_id = load_image(compass_bitmap);
-    delete_image(compass_bitmap);
-    
-    bitmap help_bitmap = load_image(resource::help, sizeof(resource::help));
-    global_state.opengl.textures.help_id = load_image(help_bitmap);
-    delete_image(help_bitmap);
+    // Order matches 'texture_layer'
+    std::vector<bitmap> bitmaps {
+            load_image(resource::texture, sizeof(resource::texture)),
+            load_image(resource::background, sizeof(resource::background)),
+            load_image(resource::compass, sizeof(resource::compass)),
+            load_image(resource::help, sizeof(resource::help))
+    };
+    global_state.opengl.textures.array_id = load_image_array(bitmaps);
+    
+    glm::uvec2 size { 0 };
+    for(const auto& map: bitmaps) size = glm::max(size, map.size);
+    auto& layer_scale = global_state.opengl.shader.layer_scale;
+    for(size_t i = 0; i < bitmaps.size( ); i++) layer_scale[i] = (glm::vec2) bitmaps[i].size / (glm::vec2) size;
+    GLint uniform_layer_scale = glGetUniformLocation(global_state.opengl.shader.tile_program, "layer_scale");
+    glProgramUniform2fv(global_state.opengl.shader.tile_program, uniform_layer_scale, (GLsizei) constants::opengl::layers_count, (GLfloat*) layer_scale);
+    for(auto& map: bitmaps) delete_image(map);
+    
+    // The background is the only layer that is filtered
+    global_state.opengl.samplers.nearest_id = load_sampler(GL_NEAREST);
+    global_state.opengl.samplers.linear_id = load_sampler(GL_LINEAR);
+    global_state.opengl.shader.linear_layers = 1u << (unsigned) texture_layer::background;
+    for(auto [flags, program]: global_state.opengl.shader.variants) update_variant_uniforms(program);
+    
+    glGenTextures(1, &global_state.opengl.textures.room_state_id);
+    bind_texture(0, GL_TEXTURE_2D, global_state.opengl.textures.room_state_id);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_R8UI, (GLsizei) constants::map::size, (GLsizei) constants::map::size);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    
+    // Storage is given once the size of the map is known
+    glGenTextures(1, &global_state.opengl.textures.map_cache_id);
+    bind_texture(0, GL_TEXTURE_2D, global_state.opengl.textures.map_cache_id);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    bind_texture(0, GL_TEXTURE_2D, 0);
+    
+    glGenTextures(1, &global_state.opengl.textures.map_overview_id);
+    bind_texture(0, GL_TEXTURE_2D, global_state.opengl.textures.map_overview_id);
+    auto levels = (GLsizei) std::log2(constants::map::size) + 1;
+    glTexStorage2D(GL_TEXTURE_2D, levels, GL_RGBA8, (GLsizei) constants::map::size, (GLsizei) constants::map::size);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    bind_texture(0, GL_TEXTURE_2D, 0);
+    
+    glGenTextures(1, &global_state.opengl.textures.frame_id);
+    glGenTextures(1, &global_state.opengl.textures.overdraw_id);
+    build_frame_target( );
 }
 void
-build_gl_items( ) {
-    glGenBuffers((GLsizei) constants::opengl::shader::buffers_count, (GLuint*) &global_state.opengl.shader.buffers);
-    glGenVertexArrays((GLsizei) constants::opengl::shader::arrays_count, (GLuint*) &global_state.opengl.shader.arrays);
+link_program(GLuint program, const std::vector<GLuint>& shaders) {
+    glLinkProgram(program);
+#if OPENGL_SHADER_TESTS
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if(linked == GL_FALSE) {
+        int length = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
+        std::vector<char> message(length);
+        glGetProgramInfoLog(program, length, nullptr, message.data( ));
+        
+        for(GLuint shader: shaders) glDeleteShader(shader);
+        
+        throw std::runtime_error(message.data( ));
+    }
+#endif
     
-    glBindVertexArray(0);
-    assign_buffer(GL_ARRAY_BUFFER, global_state.opengl.shader.buffers.quad_vertices_id, sizeof(constants::quad_vertices), &constants::quad_vertices);
-    assign_buffer(GL_ARRAY_BUFFER, global_state.opengl.shader.buffers.quad_indices_id, sizeof(constants::quad_indices), &constants::quad_indices);
-    assign_buffer(GL_ARRAY_BUFFER, global_state.opengl.shader.buffers.quad_instanced_pos_id, sizeof(rect), nullptr, GL_DYNAMIC_DRAW);
+    for(GLuint shader: shaders) glDeleteShader(shader);
+#if OPENGL_SHADER_TESTS
+    glValidateProgram(program);
+    int valid = GL_FALSE;
+    glGetProgramiv(program, GL_VALIDATE_STATUS, &valid);
+    if(valid == GL_FALSE) {
+        int length = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
+        std::vector<char> message(length);
+        glGetProgramInfoLog(program, length, nullptr, message.data( ));
+        
+        throw std::runtime_error(message.data( ));
+    }
+#endif
+}
+std::uint64_t
+hash_text(std::uint64_t hash, const std::string& text) {
+    // FNV-1a
+    for(unsigned char c: text) hash = (hash ^ c) * 0x100000001b3ull;
+    return hash;
+}
+void
+build_program_cache( ) {
+#if PROGRAM_CACHE
+    auto& cache = global_state.opengl.program_cache;
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    const char* local = std::getenv("LOCALAPPDATA");
+    if(formats == 0 || !local) return;
+    
+    cache.driver = 0xcbf29ce484222325ull;
+    for(GLenum name: { GL_VENDOR, GL_RENDERER, GL_VERSION }) cache.driver = hash_text(cache.driver, (const char*) glGetString(name));
+    
+    std::error_code error;
+    std::filesystem::path directory = std::filesystem::path(local) / "Vault Mapper" / "programs";
+    std::filesystem::create_directories(directory, error);
+    if(!error) cache.directory = directory;
+#endif
+}
+GLuint
+load_program_binary(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    GLenum format = 0;
+    if(!file.read((char*) &format, sizeof(GLenum))) return 0;
+    std::vector<char> binary { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>( ) };
+    
+    // Drivers may reject their own binaries after an update, the program is compiled again then
+    GLuint program = glCreateProgram( );
+    glProgramBinary(program, format, binary.data( ), (GLsizei) binary.size( ));
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if(linked == GL_TRUE) return program;
+    glDeleteProgram(program);
+    return 0;
+}
+void
+save_program_binary(GLuint program, const std::filesystem::path& path) {
+    GLint linked = GL_FALSE;
+    GLint length = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if(linked == GL_FALSE || length == 0) return;
+    
+    GLenum format = 0;
+    std::vector<char> binary(length);
+    glGetProgramBinary(program, length, nullptr, &format, binary.data( ));
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write((const char*) &format, sizeof(GLenum));
+    file.write(binary.data( ), (std::streamsize) binary.size( ));
+}
+GLuint
+build_program(const std::vector<std::pair<GLenum, std::vector<std::string>>>& stages, const std::function<void(GLuint)>& before_link = { }) {
+    auto& cache = global_state.opengl.program_cache;
+    auto begin = std::chrono::steady_clock::now( );
+    auto elapsed = [&begin]( ) { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now( ) - begin).count( ); };
+    
+    // Binaries are named by a hash of the driver and every source part, a change to either is a new file
+    std::filesystem::path path;
+    if(!cache.directory.empty( )) {
+        std::uint64_t key = cache.driver;
+        for(const auto& [type, parts]: stages) {
+            key = hash_text(key, std::to_string(type));
+            for(const auto& part: parts) key = hash_text(key, part);
+        }
+        char name[21];
+        std::snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long) key);
+        path = cache.directory / name;
+        
+        if(GLuint program = load_program_binary(path)) {
+            cache.loaded++;
+            cache.time += elapsed( );
+            return program;
+        }
+    }
     
+    GLuint program = glCreateProgram( );
+    if(program == 0) throw std::runtime_error("Unable to create program");
+    std::vector<GLuint> shaders;
+    for(const auto& [type, parts]: stages) {
+        shaders.push_back(load_shader(parts, type));
+        glAttachShader(program, shaders.back( ));
+    }
+    if(before_link) before_link(program);
+    if(!path.empty( )) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    link_program(program, shaders);
+    if(!path.empty( )) save_program_binary(program, path);
+    
+    cache.compiled++;
+    cache.time += elapsed( );
+    return program;
+}
+std::vector<std::string>
+variant_source(const char* source, const std::string& defines) {
+    // Defines have to follow the version line, the line directive keeps compiler messages on the lines of the source
+    std::string text = source;
+    size_t version_end = text.find('\n') + 1;
+    return { text.substr(0, version_end), defines + "#line 2\n", text.substr(version_end) };
+}
+GLuint
+build_rect_program(unsigned flags) {
+    // Instance flags the variants are specialised for and the define each sets
+    const std::pair<unsigned, const char*> flag_defines[] {
+            { constants::opengl::instance::translated, "TRANSLATED" },
+            { constants::opengl::instance::border_fade, "BORDER_FADE" },
+            { constants::opengl::instance::map_cache, "MAP_CACHE" },
+            { constants::opengl::instance::map_overview, "MAP_OVERVIEW" },
+            { constants::opengl::instance::minimap, "MINIMAP" },
+            { constants::opengl::instance::overdraw, "OVERDRAW" }
+    };
+    std::string defines;
+    for(auto [flag, define]: flag_defines) if(flags & flag) defines += std::string("#define ") + define + "\n";
+    
+    GLuint program = build_program({
+            { GL_VERTEX_SHADER, variant_source(resource::shader_vert, defines) },
+            { GL_FRAGMENT_SHADER, variant_source(resource::shader_frag, defines) }
+    }, [](GLuint program) {
+        glBindAttribLocation(program, global_state.opengl.shader.rect_attribs.vertices_id, "vertex");
+        glBindAttribLocation(program, global_state.opengl.shader.rect_attribs.uv_id, "uv");
+    });
+    
+    glProgramUniform1i(program, glGetUniformLocation(program, "image"), 0);
+    glProgramUniform1i(program, glGetUniformLocation(program, "image_linear"), 1);
+    
+    GLint uniform_screen_info = glGetUniformBlockIndex(program, "screen_info");
+    glUniformBlockBinding(program, uniform_screen_info, global_state.opengl.shader.uniform_buffers.screen_info_index);
+    GLint uniform_translation_info = glGetUniformBlockIndex(program, "translation_info");
+    glUniformBlockBinding(program, uniform_translation_info, global_state.opengl.shader.uniform_buffers.translation_info_index);
+    GLint uniform_sprite_table = glGetUniformBlockIndex(program, "sprite_table");
+    glUniformBlockBinding(program, uniform_sprite_table, global_state.opengl.shader.uniform_buffers.sprite_table_index);
+    
+    update_variant_uniforms(program);
+    return program;
+}
+GLuint
+variant_program(unsigned flags) {
+    auto& variants = global_state.opengl.shader.variants;
+    auto it = variants.find(flags);
+    if(it == variants.end( )) it = variants.emplace(flags, build_rect_program(flags)).first;
+    return it->second;
+}
+void
+build_rect_variants(unsigned flags) {
+    // Every combination a draw can be recorded with, compiling them up front keeps the compiles out of the frame
+    const unsigned sources[] {
+            0,
+            constants::opengl::instance::map_cache,
+            constants::opengl::instance::map_overview,
+            constants::opengl::instance::map_overview | constants::opengl::instance::minimap
+    };
+    const unsigned states[] {
+            0,
+            constants::opengl::instance::translated,
+            constants::opengl::instance::border_fade,
+            constants::opengl::instance::translated | constants::opengl::instance::border_fade
+    };
+    for(unsigned source: sources)
+        for(unsigned state: states) variant_program(flags | source | state);
+}
+void
+build_rect_array(GLuint array_id, GLuint instances_id) {
     /**
      * @code
      * Attrib parts -------------------- Buf - Attributes
      * ==================================================
      * vertex, uv-------------------------------- [0] - 0 1
      * indices ---------------------------------- [1]
-     * position, size, uv_position, uv_size - i - [2] - 2 3 4 5
+     * position, sprite, uv_tr ------------ i - [2] - 2 3 4
      * @endcode
      */
-    glBindVertexArray(global_state.opengl.shader.arrays.quad_id);
+    glBindVertexArray(array_id);
     attrib_builder quad_builder((GLuint*) &global_state.opengl.shader.rect_attribs, constants::opengl::shader::rect_attribs_count);
-    glBindBuffer(GL_ARRAY_BUFFER, global_state.opengl.shader.buffers.quad_vertices_id);
+    bind_buffer(GL_ARRAY_BUFFER, global_state.opengl.shader.buffers.quad_vertices_id);
     quad_builder.attribute(3, GL_FLOAT, sizeof(quad_vertex), offsetof(quad_vertex, position));
     quad_builder.attribute(2, GL_FLOAT, sizeof(quad_vertex), offsetof(quad_vertex, uv));
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, global_state.opengl.shader.buffers.quad_indices_id);
     // Instanced buffer
-    glBindBuffer(GL_ARRAY_BUFFER, global_state.opengl.shader.buffers.quad_instanced_pos_id);
-    quad_builder.attribute_i(2, GL_INT, sizeof(rect), offsetof(rect, dimensions.position), true);
-    quad_builder.attribute_i(2, GL_UNSIGNED_INT, sizeof(rect), offsetof(rect, dimensions.size), true);
-    quad_builder.attribute(2, GL_FLOAT, sizeof(rect), offsetof(rect, texture.position), true);
-    quad_builder.attribute(2, GL_FLOAT, sizeof(rect), offsetof(rect, texture.size), true);
-    quad_builder.attribute_i(1, GL_UNSIGNED_INT, sizeof(rect), offsetof(rect, uv_tr), true);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    bind_buffer(GL_ARRAY_BUFFER, instances_id);
+    quad_builder.attribute_i(2, GL_SHORT, sizeof(rect_instance), offsetof(rect_instance, x), true);
+    quad_builder.attribute_i(1, GL_UNSIGNED_SHORT, sizeof(rect_instance), offsetof(rect_instance, sprite), true);
+    quad_builder.attribute_i(1, GL_UNSIGNED_BYTE, sizeof(rect_instance), offsetof(rect_instance, uv_tr), true);
+    bind_buffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
+}
+void
+build_instance_ring(unsigned region_size) {
+    auto& ring = global_state.opengl.ring;
+    
+    // Storage can not be resized once created so a full ring is replaced with a larger one
+    if(ring.mapped) {
+        glFinish( );
+        forget_buffer(global_state.opengl.shader.buffers.quad_instanced_pos_id);
+        glDeleteBuffers(1, &global_state.opengl.shader.buffers.quad_instanced_pos_id);
+        glGenBuffers(1, &global_state.opengl.shader.buffers.quad_instanced_pos_id);
+    }
+    for(auto& fence: ring.fences) {
+        if(fence) glDeleteSync(fence);
+        fence = nullptr;
+    }
+    
+    constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    auto size = (GLsizeiptr) (sizeof(rect_instance) * region_size * constants::opengl::ring::regions);
+    bind_buffer(GL_ARRAY_BUFFER, global_state.opengl.shader.buffers.quad_instanced_pos_id);
+    glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+    ring.mapped = (rect_instance*) glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+    bind_buffer(GL_ARRAY_BUFFER, 0);
+    if(ring.mapped == nullptr) throw std::runtime_error("Failed to map the instance ring");
+    
+    ring.region_size = region_size;
+    ring.region = 0;
+    ring.head = 0;
+    ring.command_head = 0;
+    ring.command_first = 0;
+    if(ring.commands) return;
+    
+    // Stays bound, every draw of the frame is sourced from it, readable for the instance counts the map culling writes
+    size = (GLsizeiptr) (sizeof(draw_command) * constants::opengl::ring::region_commands * constants::opengl::ring::regions);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, global_state.opengl.shader.buffers.draw_commands_id);
+    glBufferStorage(GL_DRAW_INDIRECT_BUFFER, size, nullptr, flags | GL_MAP_READ_BIT);
+    ring.commands = (draw_command*) glMapBufferRange(GL_DRAW_INDIRECT_BUFFER, 0, size, flags | GL_MAP_READ_BIT);
+    if(ring.commands == nullptr) throw std::runtime_error("Failed to map the draw commands");
+}
+void
+build_gl_items( ) {
+    glGenBuffers((GLsizei) constants::opengl::shader::buffers_count, (GLuint*) &global_state.opengl.shader.buffers);
+    glGenVertexArrays((GLsizei) constants::opengl::shader::arrays_count, (GLuint*) &global_state.opengl.shader.arrays);
+    glGenFramebuffers((GLsizei) constants::opengl::framebuffers_count, (GLuint*) &global_state.opengl.framebuffers);
+#if FRAME_PROFILER
+    glGenQueries((GLsizei) (constants::profiler::frames * constants::profiler::stages), &global_state.profiler.queries[0][0]);
+#endif
+    
+    glBindVertexArray(0);
+    assign_buffer(GL_ARRAY_BUFFER, global_state.opengl.shader.buffers.quad_vertices_id, sizeof(constants::quad_vertices), &constants::quad_vertices);
+    assign_buffer(GL_ARRAY_BUFFER, global_state.opengl.shader.buffers.quad_indices_id, sizeof(constants::quad_indices), &constants::quad_indices);
+    build_instance_ring(constants::opengl::ring::region_size);
+    assign_buffer(GL_ARRAY_BUFFER, global_state.opengl.shader.buffers.map_instances_id, sizeof(rect_instance), nullptr, GL_DYNAMIC_DRAW);
+    assign_buffer(GL_ATOMIC_COUNTER_BUFFER, global_state.opengl.shader.buffers.overdraw_counter_id, sizeof(GLuint) * constants::opengl::ring::regions, nullptr,
+            GL_DYNAMIC_READ);
+    
+    build_rect_array(global_state.opengl.shader.arrays.quad_id, global_state.opengl.shader.buffers.quad_instanced_pos_id);
     
     assign_buffer<false>(GL_UNIFORM_BUFFER, global_state.opengl.shader.buffers.screen_info_id, sizeof(screen_info), nullptr, GL_DYNAMIC_DRAW);
     glBindBufferRange(GL_UNIFORM_BUFFER, global_state.opengl.shader.uniform_buffers.screen_info_index, global_state.opengl.shader.buffers.screen_info_id, 0,
             sizeof(screen_info));
-    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    bind_buffer(GL_UNIFORM_BUFFER, 0);
     assign_buffer<false>(GL_UNIFORM_BUFFER, global_state.opengl.shader.buffers.translation_id, sizeof(translation_info), nullptr, GL_DYNAMIC_DRAW);
     glBindBufferRange(GL_UNIFORM_BUFFER, global_state.opengl.shader.uniform_buffers.translation_info_index, global_state.opengl.shader.buffers.translation_id, 0,
             sizeof(translation_info));
-    glBindBuffer(GL_UNIFORM_BUFFER, 0);
-    
-    global_state.opengl.shader.program = glCreateProgram( );
+    bind_buffer(GL_UNIFORM_BUFFER, 0);
+    assign_buffer<false>(GL_UNIFORM_BUFFER, global_state.opengl.shader.buffers.sprite_table_id, sizeof(sprite_data) * constants::opengl::sprite_count, nullptr, GL_DYNAMIC_DRAW);
+    glBindBufferRange(GL_UNIFORM_BUFFER, global_state.opengl.shader.uniform_buffers.sprite_table_index, global_state.opengl.shader.buffers.sprite_table_id, 0,
+            sizeof(sprite_data) * constants::opengl::sprite_count);
+    bind_buffer(GL_UNIFORM_BUFFER, 0);
     
     //std::stringstream stream;
     //std::ifstream file_stream("res/shader_vert.glsl");
@@ -483,93 +1279,156 @@ build_gl_items( ) {
     //stream << file_stream.rdbuf( );
     //file_stream.close( );
     
-    GLuint vert_id = load_shader({ resource::shader_vert }, GL_VERTEX_SHADER);
-    glAttachShader(global_state.opengl.shader.program, vert_id);
-    
-    //stream.str({ });
-    //file_stream.open("res/shader_frag.glsl");
-    //if(!file_stream.is_open( )) throw std::runtime_error("unable to load vertex shader file");
-    //stream << file_stream.rdbuf( );
-    //file_stream.close( );
-    
-    GLuint frag_id = load_shader({ resource::shader_frag }, GL_FRAGMENT_SHADER);
-    glAttachShader(global_state.opengl.shader.program, frag_id);
-    
-    glBindAttribLocation(global_state.opengl.shader.program, global_state.opengl.shader.rect_attribs.vertices_id, "vertex");
-    glBindAttribLocation(global_state.opengl.shader.program, global_state.opengl.shader.rect_attribs.uv_id, "uv");
-    
-    glLinkProgram(global_state.opengl.shader.program);
-#if OPENGL_SHADER_TESTS
-    GLint linked = GL_FALSE;
-    glGetProgramiv(global_state.opengl.shader.program, GL_LINK_STATUS, &linked);
-    if(linked == GL_FALSE) {
-        int length = 0;
-        glGetProgramiv(global_state.opengl.shader.program, GL_INFO_LOG_LENGTH, &length);
-        std::vector<char> message(length);
-        glGetProgramInfoLog(global_state.opengl.shader.program, length, nullptr, message.data( ));
-        
-        glDeleteShader(vert_id);
-        glDeleteShader(frag_id);
-        
-        throw std::runtime_error(message.data( ));
-    }
+    build_program_cache( );
+    
+    // The overdraw variants are only built once the overdraw is first shown
+    build_rect_variants(0);
+    global_state.opengl.shader.program = variant_program(0);
+    global_state.opengl.shader.tile_program = build_program({ { GL_VERTEX_SHADER, { resource::tile_vert } }, { GL_FRAGMENT_SHADER, { resource::tile_frag } } });
+    global_state.opengl.shader.expand_program = build_program({ { GL_COMPUTE_SHADER, { resource::expand_comp } } });
+    global_state.opengl.shader.cull_program = build_program({ { GL_COMPUTE_SHADER, { resource::cull_comp } } });
+    global_state.opengl.shader.heatmap_program = build_program({ { GL_VERTEX_SHADER, { resource::tile_vert } }, { GL_FRAGMENT_SHADER, { resource::heatmap_frag } } });
+#if RENDER_STATISTICS
+    auto& cache = global_state.opengl.program_cache;
+    std::cout << "Programs: " << cache.loaded << " loaded from cache, " << cache.compiled << " compiled in " << cache.time << " ms" << std::endl;
 #endif
+    GLint uniform_screen_info = glGetUniformBlockIndex(global_state.opengl.shader.cull_program, "screen_info");
+    glUniformBlockBinding(global_state.opengl.shader.cull_program, uniform_screen_info, global_state.opengl.shader.uniform_buffers.screen_info_index);
+    GLint uniform_translation_info = glGetUniformBlockIndex(global_state.opengl.shader.cull_program, "translation_info");
+    glUniformBlockBinding(global_state.opengl.shader.cull_program, uniform_translation_info, global_state.opengl.shader.uniform_buffers.translation_info_index);
     
-    glDeleteShader(vert_id);
-    glDeleteShader(frag_id);
-    glValidateProgram(global_state.opengl.shader.program);
-#if OPENGL_SHADER_TESTS
-    glValidateProgram(global_state.opengl.shader.program);
-    int valid = GL_FALSE;
-    glGetProgramiv(global_state.opengl.shader.program, GL_VALIDATE_STATUS, &valid);
-    if(valid == GL_FALSE) {
-        int length = 0;
-        glGetProgramiv(global_state.opengl.shader.program, GL_INFO_LOG_LENGTH, &length);
-        std::vector<char> message(length);
-        glGetProgramInfoLog(global_state.opengl.shader.program, length, nullptr, message.data( ));
-        
-        throw std::runtime_error(message.data( ));
-    }
-#endif
-    glUseProgram(0);
-    
-    GLint uniform_image = glGetUniformLocation(global_state.opengl.shader.program, "image");
-    glProgramUniform1i(global_state.opengl.shader.program, uniform_image, 0);
-    
-    global_state.opengl.shader.uniforms.border_fade_id = glGetUniformLocation(global_state.opengl.shader.program, "border_fade");
-    
-    GLint uniform_screen_info = glGetUniformBlockIndex(global_state.opengl.shader.program, "screen_info");
-    glUniformBlockBinding(global_state.opengl.shader.program, uniform_screen_info, global_state.opengl.shader.uniform_buffers.screen_info_index);
-    GLint uniform_translation_info = glGetUniformBlockIndex(global_state.opengl.shader.program, "translation_info");
-    glUniformBlockBinding(global_state.opengl.shader.program, uniform_translation_info, global_state.opengl.shader.uniform_buffers.translation_info_index);
+    uniform_screen_info = glGetUniformBlockIndex(global_state.opengl.shader.tile_program, "screen_info");
+    glUniformBlockBinding(global_state.opengl.shader.tile_program, uniform_screen_info, global_state.opengl.shader.uniform_buffers.screen_info_index);
+    uniform_translation_info = glGetUniformBlockIndex(global_state.opengl.shader.tile_program, "translation_info");
+    glUniformBlockBinding(global_state.opengl.shader.tile_program, uniform_translation_info, global_state.opengl.shader.uniform_buffers.translation_info_index);
     
     build_gl_images( );
+    
+    // The texture array stays bound through both samplers, instances select their layer
+    bind_texture(0, GL_TEXTURE_2D_ARRAY, global_state.opengl.textures.array_id);
+    glBindSampler(0, global_state.opengl.samplers.nearest_id);
+    bind_texture(1, GL_TEXTURE_2D_ARRAY, global_state.opengl.textures.array_id);
+    glBindSampler(1, global_state.opengl.samplers.linear_id);
+    bind_texture(2, GL_TEXTURE_2D, global_state.opengl.textures.room_state_id);
+    bind_texture(3, GL_TEXTURE_2D, global_state.opengl.textures.map_cache_id);
+    bind_texture(4, GL_TEXTURE_2D, global_state.opengl.textures.map_overview_id);
 }
 
 void
 update( );
 void
 render( );
+void
+build_tile_sprites( );
+void
+build_expand_sprites( );
 
 void
-update_translation_position( ) {
-    glm::vec2 position = global_state.map.view_position + (glm::ivec2) (global_state.window.size / 2u);
-    glBindBuffer(GL_UNIFORM_BUFFER, global_state.opengl.shader.buffers.translation_id);
-    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(glm::vec2), &position);
-    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+update_translation( ) {
+    // The whole move is one write, the shaders evaluate it for the current time
+    auto& camera = global_state.map.camera;
+    auto& translation = global_state.opengl.state.translation;
+    glm::vec2 half = (glm::vec2) (global_state.window.size / 2u);
+    translation = {
+            camera.start + half, (glm::vec2) camera.target + half, camera.start_scale, camera.target_scale,
+            (float) camera.start_time, camera.moving ? (float) constants::map::camera_duration : 0.0f, translation.time
+    };
+    global_state.opengl.state.uniform_writes++;
 }
 void
-update_translation_scale(unsigned scale) {
-    scale = global_state.global_scale * scale;
-    glBindBuffer(GL_UNIFORM_BUFFER, global_state.opengl.shader.buffers.translation_id);
-    glBufferSubData(GL_UNIFORM_BUFFER, sizeof(glm::vec2), sizeof(glm::uint), &scale);
-    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+start_view_move( ) {
+    // Starts from wherever the view is now, a move to where it already is only places it
+    auto& camera = global_state.map.camera;
+    camera.start = camera.position;
+    camera.start_scale = camera.scale;
+    camera.target = global_state.map.target_view_position;
+    camera.target_scale = global_state.map.target_view_scale;
+    camera.start_time = glfwGetTime( );
+    camera.moving = camera.start != (glm::vec2) camera.target || camera.start_scale != camera.target_scale;
+    update_translation( );
+}
+inline float
+zoom_scale(unsigned level) {
+    // The lowest levels halve the scale each, the others are whole multiples
+    if(level <= constants::map::zoom_out_levels) return 1.0f / (float) (1u << (constants::map::zoom_out_levels + 1 - level));
+    return (float) (level - constants::map::zoom_out_levels);
 }
 void
-enable_translation(large_bool enabled) {
-    glBindBuffer(GL_UNIFORM_BUFFER, global_state.opengl.shader.buffers.translation_id);
-    glBufferSubData(GL_UNIFORM_BUFFER, sizeof(glm::vec2) + sizeof(glm::uint), sizeof(large_bool), &enabled);
-    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+update_translation_scale(float scale) {
+    // Zooms over the next moves like the position does
+    global_state.map.target_view_scale = (float) global_state.global_scale * scale;
+}
+void
+update_screen_info(const glm::uvec2& size) {
+    global_state.opengl.state.screen.size = size;
+    global_state.opengl.state.uniform_writes++;
+}
+void
+enable_translation(bool enabled) {
+    if(enabled) global_state.opengl.frame.flags |= constants::opengl::instance::translated;
+    else global_state.opengl.frame.flags &= ~constants::opengl::instance::translated;
+}
+void
+enable_border_fade(bool enabled) {
+    if(enabled) global_state.opengl.frame.flags |= constants::opengl::instance::border_fade;
+    else global_state.opengl.frame.flags &= ~constants::opengl::instance::border_fade;
+}
+void
+damage_window(const glm::ivec2& position, const glm::uvec2& size) {
+    // Changes that only touch part of the window record it instead of asking for a full redraw
+    auto& damage = global_state.opengl.damage;
+    glm::ivec2 high = position + (glm::ivec2) size;
+    damage.low = damage.pending ? glm::min(damage.low, position) : position;
+    damage.high = damage.pending ? glm::max(damage.high, high) : high;
+    damage.pending = true;
+}
+void
+damage_room(const glm::ivec2& room) {
+    // Same transform as the vertex shader, the room with its door stubs
+    auto& camera = global_state.map.camera;
+    glm::vec2 position = ((glm::vec2) (room * (int) constants::map::room_area - constants::map::room_extent) + camera.position) * camera.scale +
+            (glm::vec2) (global_state.window.size / 2u);
+    auto size = (unsigned) std::ceil(constants::map::room_extent * 2 * camera.scale) + 1;
+    damage_window((glm::ivec2) glm::floor(position), glm::uvec2(size));
+}
+glm::ivec2
+minimap_position( ) {
+    // Below the compass
+    return { (int) global_state.window.size.x - (int) constants::map::minimap_size - 8, 8 + 128 + 8 };
+}
+glm::uvec2
+global_keys_dot_size( ) {
+    return glm::uvec2(16, 16) * global_state.global_scale;
+}
+glm::ivec2
+global_keys_dot_position( ) {
+    // Bottom left, the margin stays the same whatever the dot's scale
+    return { 8, (int) global_state.window.size.y - (int) global_keys_dot_size( ).y - 8 };
+}
+bool
+apply_window_changes( ) {
+    // Everything that follows the window size is updated here once per frame, false while the window is minimized
+    auto& window = global_state.window;
+    if(!window.resized) return true;
+    if(window.pending_size.x == 0 || window.pending_size.y == 0) return false;
+    window.resized = false;
+    
+    if(window.pending_scale > 0) {
+        global_state.global_scale = (unsigned) std::max(std::lround(window.pending_scale), 1l);
+        window.pending_scale = 0;
+        update_translation_scale(global_state.map.view_portal_room ? 1.0f : zoom_scale(global_state.map.scale));
+        global_state.map.camera.scale = global_state.map.target_view_scale;
+        start_view_move( );
+    }
+    if(window.pending_size != window.size) {
+        window.size = window.pending_size;
+        glViewport(0, 0, (GLsizei) window.size.x, (GLsizei) window.size.y);
+        update_screen_info(window.size);
+        update_translation( );
+    }
+    build_frame_target( );
+    global_state.redraw = true;
+    return true;
 }
 
 #define DISCARD { global_state.discard = true; return; }
@@ -578,12 +1437,22 @@ LRESULT CALLBACK
 WindowGlobalKeyboard(int code, WPARAM wParam, LPARAM lParam);
 void
 keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mods);
+void
+framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void
+content_scale_callback(GLFWwindow* window, float x, float y);
+void
+window_refresh_callback(GLFWwindow* window);
+void
+mouse_button_callback(GLFWwindow* window, int button, int action, int mods);
 
 void
 init_map(path_flag paths);
 void
 reset_map( );
 void
+map_changed(const glm::ivec2& pos, bool opened = false);
+void
 add_surrounding_rooms(glm::ivec2 pos) {
     path_flag paths = global_state.map.rooms[point_id(pos)].paths;
     
@@ -620,114 +1489,937 @@ add_surrounding_rooms(glm::ivec2 pos) {
         } else {
             global_state.map.rooms[point_id(around)] = { around, (path_flag) open, room_flag::none, false };
         }
+        map_changed(around);
     }
+    map_changed(pos);
 }
 void
 add_room(glm::ivec2 pos, path_flag paths, room_flag flags, bool visited = true) {
     if(global_state.map.rooms.find(point_id(pos)) != std::end(global_state.map.rooms)) return;
     global_state.map.rooms[point_id(pos)] = room_data { pos, paths, flags, visited };
+    map_changed(pos);
+}
+void
+push_path(const glm::ivec2& point, path_flag direction) {
+    player_data& player = active_player( );
+    unsigned position = player.path_size;
+    if(player.path_size == 10) {
+        position = player.path_head;
+        if(player.path_head == 9) player.path_head = 0;
+        else player.path_head++;
+    } else player.path_size++;
+    player.path[position] = { point, direction };
+}
+void
+map_changed(const glm::ivec2& pos, bool opened) {
+    // Closing a door or narrowing a room only makes routes longer so the landmark tables stay a lower bound,
+    // opening a door can make them overestimate
+    if(opened) global_state.map.landmarks.stale = true;
+    global_state.map.corridors.dirty.insert(point_id(pos));
+    
+    // Any change can alter the routes so all speculated moves are discarded
+    for(auto& move: global_state.map.speculation.moves) move.ready = false;
+    global_state.map.speculation.next = 0;
+    
+    global_state.map.route_table.stale = true;
+    
+    // The path stubs of a room depend on its neighbors, a door toggle also changes the room it faces
+    global_state.map.tiles.dirty.insert(point_id(pos));
+    global_state.map.layer.dirty.insert(point_id(pos));
+    for(const auto& dir: constants::directions<int>) {
+        if(!in_map(pos + dir)) continue;
+        global_state.map.tiles.dirty.insert(point_id(pos + dir));
+        global_state.map.layer.dirty.insert(point_id(pos + dir));
+    }
+    global_state.map.cache.stale = true;
+    
+    // The area only moves when the explored bounds grow, the overview texels themselves are updated with the room states
+    auto& minimap = global_state.map.minimap;
+    glm::ivec2 low = minimap.empty ? pos : glm::min(minimap.low, pos);
+    glm::ivec2 high = minimap.empty ? pos : glm::max(minimap.high, pos);
+    if(minimap.empty || low != minimap.low || high != minimap.high) minimap.stale = true;
+    minimap.low = low;
+    minimap.high = high;
+    minimap.empty = false;
+    damage_window(minimap_position( ), glm::uvec2(constants::map::minimap_size));
+}
+void
+build_landmark_table(const std::vector<std::uint8_t>& cells, const glm::ivec2& landmark, std::vector<std::uint16_t>& table) {
+    constexpr unsigned size = constants::map::size;
+    static std::vector<unsigned> queue;
+    
+    table.assign(constants::map::cell_count, constants::map::landmark_unreachable);
+    queue.clear( );
+    
+    auto start = (unsigned) point_id(landmark);
+    table[start] = 0;
+    queue.push_back(start);
+    for(size_t head = 0; head < queue.size( ); head++) {
+        unsigned cell = queue[head];
+        unsigned x = cell % size;
+        unsigned y = cell / size;
+        
+        // Order matches 'path_flag': south, east, north, west
+        bool inside[] { y + 1 < size, x + 1 < size, y > 0, x > 0 };
+        unsigned next[] { cell + size, cell + 1, cell - size, cell - 1 };
+        for(unsigned i = 0; i < 4; i++) {
+            if(!inside[i]) continue;
+            unsigned n = next[i];
+            if(table[n] != constants::map::landmark_unreachable) continue;
+            // A door open from either side counts, the tables then bound the route in both directions
+            if(!(cells[cell] & (1 << i)) && !(cells[n] & (1 << ((i + 2) & 3)))) continue;
+            
+            table[n] = table[cell] + 1;
+            queue.push_back(n);
+        }
+    }
+}
+size_t
+landmark_memory( ) {
+    size_t bytes = 0;
+    for(const auto& table: global_state.map.landmarks.distances)
+        bytes += table.capacity( ) * sizeof(std::uint16_t);
+    return bytes;
+}
+void
+update_landmarks( ) {
+    auto& landmarks = global_state.map.landmarks;
+    auto& rooms = global_state.map.rooms;
+    
+    // Choose new landmarks every time the map doubles in size
+    bool reselect = landmarks.positions.empty( ) || rooms.size( ) >= landmarks.chosen_room_count * 2;
+    if(!landmarks.stale && !reselect) return;
+    
+    static std::vector<std::uint8_t> cells;
+    cells.assign(constants::map::cell_count, (std::uint8_t) path_flag::all);
+    for(const auto& item: rooms)
+        cells[(unsigned) item.first] = (std::uint8_t) item.second.paths;
+    
+    if(reselect) {
+        landmarks.positions.assign(1, constants::zero<int>);
+        landmarks.chosen_room_count = rooms.size( );
+    }
+    landmarks.distances.resize(landmarks.positions.size( ));
+    for(size_t i = 0; i < landmarks.positions.size( ); i++)
+        build_landmark_table(cells, landmarks.positions[i], landmarks.distances[i]);
+    
+    // Farthest point selection, each new landmark is the room farthest from all current ones
+    while(reselect && landmarks.positions.size( ) < constants::map::landmark_count) {
+        glm::ivec2 farthest = constants::zero<int>;
+        unsigned farthest_distance = 0;
+        for(const auto& item: rooms) {
+            unsigned distance = constants::map::landmark_unreachable;
+            for(const auto& table: landmarks.distances)
+                distance = std::min(distance, (unsigned) table[(unsigned) item.first]);
+            if(distance == constants::map::landmark_unreachable || distance <= farthest_distance) continue;
+            farthest = item.second.position;
+            farthest_distance = distance;
+        }
+        if(farthest_distance == 0) break;
+        
+        landmarks.positions.push_back(farthest);
+        landmarks.distances.emplace_back( );
+        build_landmark_table(cells, farthest, landmarks.distances.back( ));
+    }
+    landmarks.stale = false;
+#if ROUTE_STATISTICS
+    std::cout << "Landmarks: " << landmarks.positions.size( ) << " tables, " << landmark_memory( ) << " bytes" << std::endl;
+#endif
+}
+unsigned
+calc_heuristic(const glm::ivec2& p, const glm::ivec2& target) {
+    return std::abs(p.x - target.x) + std::abs(p.y - target.y);
+}
+unsigned
+calc_landmark_heuristic(point_id_t point, point_id_t target) {
+    unsigned best = 0;
+    for(const auto& table: global_state.map.landmarks.distances) {
+        unsigned from = table[(unsigned) point];
+        unsigned to = table[(unsigned) target];
+        if(from == constants::map::landmark_unreachable && to == constants::map::landmark_unreachable) continue;
+        // Only one of them connects to the landmark so there is no route between them at all
+        if(from == constants::map::landmark_unreachable || to == constants::map::landmark_unreachable)
+            return constants::map::landmark_unreachable;
+        best = std::max(best, from > to ? from - to : to - from);
+    }
+    return best;
+}
+unsigned
+calc_step_cost(point_id_t point) {
+    // Costs are doubled so a visited room is the cheapest step at 2
+    auto found = global_state.map.rooms.find(point);
+    if(found == std::end(global_state.map.rooms)) return 6;
+    if((unsigned) found->second.flags & (unsigned) room_flag::avoid) return 10;
+    return found->second.visited ? 2 : 3;
+}
+bool
+find_route(const glm::ivec2& start, const glm::ivec2& target, std::vector<glm::ivec2>& route, unsigned* expansions = nullptr, bool use_landmarks = true) {
+    route.clear( );
+    if(expansions) *expansions = 0;
+    if(start == target) return true;
+    if(use_landmarks) update_landmarks( );
+    
+    std::map<point_id_t, astar_point> point_data;
+    std::priority_queue<queued_point> points;
+    
+    point_id_t start_id = point_id(start);
+    point_id_t target_id = point_id(target);
+    // Lower bound on the rooms left to the target, the cheapest step costs 2
+    auto hops = [&](const glm::ivec2& p, point_id_t pi) {
+        unsigned h = calc_heuristic(p, target);
+        if(use_landmarks) h = std::max(h, calc_landmark_heuristic(pi, target_id));
+        return h;
+    };
+    
+    unsigned start_hops = hops(start, start_id);
+    if(start_hops > constants::map::route_length) return false;
+    point_data[start_id] = { start, constants::zero<int>, 0, 0 };
+    points.emplace(start_hops * 2, 0, start_id);
+    
+    while(!points.empty( )) {
+        auto pi = points.top( ).point;
+        points.pop( );
+        
+        auto& p = point_data[pi];
+        if(p.closed) continue;
+        p.closed = true;
+        if(expansions) (*expansions)++;
+        if(pi == target_id) break;
+        if(p.path_length >= constants::map::route_length) continue;
+        
+        auto found = global_state.map.rooms.find(pi);
+        path_flag paths = path_flag::all;
+        if(found != std::end(global_state.map.rooms))
+            paths = found->second.paths;
+        
+        for(int i = 0; i < 4; i++) {
+            if(!((unsigned) paths & (1 << i))) continue;
+            
+            auto dir = constants::directions<int>[i];
+            auto n = p.position + dir;
+            if(!in_map(n)) continue;
+            auto ni = point_id(n);
+            
+            // Skip rooms that cannot reach the target within the route length
+            unsigned n_hops = hops(n, ni);
+            if(p.path_length + 1 + n_hops > constants::map::route_length) continue;
+            
+            unsigned cost = p.cost + calc_step_cost(ni);
+            auto [next, inserted] = point_data.try_emplace(ni, n, -dir, p.path_length + 1, cost);
+            if(!inserted) {
+                if(next->second.closed || next->second.cost <= cost) continue;
+                next->second = { n, -dir, p.path_length + 1, cost };
+            }
+            points.emplace(cost + n_hops * 2, cost, ni);
+        }
+    }
+    
+    auto found = point_data.find(target_id);
+    if(found == std::end(point_data) || !found->second.closed) return false;
+    
+    auto pos = target;
+    while(pos != start) {
+        auto next = point_data.at(point_id(pos)).parent_dir;
+        route.push_back(next);
+        pos += next;
+    }
+    return true;
+}
+const room_data*
+corridor_neighbor(const room_data& room, unsigned door) {
+    // Corridors only follow doors open from both sides into explored rooms
+    if(!((unsigned) room.paths & (1 << door))) return nullptr;
+    glm::ivec2 n = room.position + constants::directions<int>[door];
+    if(!in_map(n)) return nullptr;
+    
+    auto found = global_state.map.rooms.find(point_id(n));
+    if(found == std::end(global_state.map.rooms)) return nullptr;
+    if(!((unsigned) found->second.paths & (1 << ((door + 2) & 3)))) return nullptr;
+    return &found->second;
+}
+bool
+is_junction(const room_data& room) {
+    if(room.flags == room_flag::portal) return true;
+    
+    unsigned doors = 0;
+    for(unsigned i = 0; i < 4; i++) {
+        if(!((unsigned) room.paths & (1 << i))) continue;
+        // A door leading out of the explored map ends the corridor
+        if(!corridor_neighbor(room, i)) return true;
+        doors++;
+    }
+    return doors != 2;
+}
+corridor_edge
+walk_corridor(const room_data& from, unsigned door, point_id_t stop) {
+    corridor_edge edge { };
+    const room_data* room = &from;
+    for(unsigned i = 0; i < constants::map::cell_count; i++) {
+        room = corridor_neighbor(*room, door);
+        edge.junction = point_id(room->position);
+        edge.cost += calc_step_cost(edge.junction);
+        edge.steps.push_back(constants::directions<int>[door]);
+        if(edge.junction == stop || room == &from || is_junction(*room)) break;
+        
+        // Leave through the door that was not entered
+        unsigned entered = (door + 2) & 3;
+        for(unsigned d = 0; d < 4; d++) {
+            if(d == entered || !((unsigned) room->paths & (1 << d))) continue;
+            door = d;
+            break;
+        }
+    }
+    return edge;
+}
+void
+update_corridors( ) {
+    auto& corridors = global_state.map.corridors;
+    if(corridors.dirty.empty( )) return;
+    
+    // A change can alter a room's door count and its neighbors' so both are reclassified
+    std::set<point_id_t> changed;
+    for(auto point: corridors.dirty) {
+        glm::ivec2 pos = point_position(point);
+        changed.insert(point);
+        for(const auto& dir: constants::directions<int>)
+            if(in_map(pos + dir)) changed.insert(point_id(pos + dir));
+    }
+    corridors.dirty.clear( );
+    
+    // Every corridor touching a changed room is walked again from both of its ends
+    std::set<point_id_t> rewalk;
+    for(auto point: changed) {
+        auto junction = corridors.junctions.find(point);
+        if(junction != std::end(corridors.junctions)) {
+            rewalk.insert(point);
+            for(const auto& edge: junction->second)
+                rewalk.insert(edge.junction);
+        }
+        auto inner = corridors.interior.find(point);
+        if(inner != std::end(corridors.interior)) {
+            rewalk.insert(inner->second.first);
+            rewalk.insert(inner->second.second);
+        }
+    }
+    for(auto point: rewalk) {
+        auto junction = corridors.junctions.find(point);
+        if(junction == std::end(corridors.junctions)) continue;
+        for(const auto& edge: junction->second) {
+            glm::ivec2 pos = point_position(point);
+            for(size_t i = 0; i + 1 < edge.steps.size( ); i++)
+                corridors.interior.erase(point_id(pos += edge.steps[i]));
+        }
+        junction->second.clear( );
+    }
+    
+    for(auto point: changed) {
+        auto room = global_state.map.rooms.find(point);
+        if(room != std::end(global_state.map.rooms) && is_junction(room->second)) {
+            corridors.junctions[point];
+            corridors.interior.erase(point);
+            rewalk.insert(point);
+        } else corridors.junctions.erase(point);
+    }
+    
+    for(auto point: rewalk) {
+        auto junction = corridors.junctions.find(point);
+        if(junction == std::end(corridors.junctions)) continue;
+        const room_data& room = global_state.map.rooms.at(point);
+        for(unsigned i = 0; i < 4; i++) {
+            if(!corridor_neighbor(room, i)) continue;
+            corridor_edge edge = walk_corridor(room, i, point);
+            
+            glm::ivec2 pos = room.position;
+            for(size_t j = 0; j + 1 < edge.steps.size( ); j++)
+                corridors.interior[point_id(pos += edge.steps[j])] = { point, edge.junction };
+            if(edge.junction != point) junction->second.push_back(std::move(edge));
+        }
+    }
+}
+std::vector<corridor_edge>
+corridor_edges_from(const room_data& room, point_id_t stop) {
+    std::vector<corridor_edge> edges;
+    point_id_t point = point_id(room.position);
+    for(unsigned i = 0; i < 4; i++) {
+        if(!corridor_neighbor(room, i)) continue;
+        corridor_edge edge = walk_corridor(room, i, stop);
+        if(edge.junction != point) edges.push_back(std::move(edge));
+    }
+    return edges;
+}
+std::map<point_id_t, corridor_edge>
+corridor_edges_into(const room_data& room, point_id_t stop) {
+    std::map<point_id_t, corridor_edge> edges;
+    point_id_t point = point_id(room.position);
+    for(auto& edge: corridor_edges_from(room, stop)) {
+        // Reverse the walk so it leads from the corridor end into the room
+        unsigned cost = edge.cost - calc_step_cost(edge.junction) + calc_step_cost(point);
+        auto [into, inserted] = edges.try_emplace(edge.junction);
+        if(!inserted && into->second.cost <= cost) continue;
+        into->second.junction = point;
+        into->second.cost = cost;
+        into->second.steps.assign(edge.steps.rbegin( ), edge.steps.rend( ));
+        for(auto& step: into->second.steps) step = -step;
+    }
+    return edges;
+}
+std::vector<corridor_edge>
+room_steps(point_id_t point, bool reverse) {
+    // Single steps find_route takes that no corridor covers, through unexplored cells and doors open from one side
+    std::vector<corridor_edge> edges;
+    glm::ivec2 pos = point_position(point);
+    auto room = global_state.map.rooms.find(point);
+    bool junction = global_state.map.corridors.junctions.count(point);
+    for(unsigned i = 0; i < 4; i++) {
+        glm::ivec2 n = pos + constants::directions<int>[i];
+        if(!in_map(n)) continue;
+        point_id_t ni = point_id(n);
+        if(junction && corridor_neighbor(room->second, i)) continue;
+        
+        // Reversed steps lead from the neighbor into this room for searches walking backwards from their target
+        auto from = reverse ? global_state.map.rooms.find(ni) : room;
+        unsigned door = reverse ? (i + 2) & 3 : i;
+        if(from != std::end(global_state.map.rooms) && !((unsigned) from->second.paths & (1 << door))) continue;
+        edges.push_back({ ni, calc_step_cost(reverse ? point : ni), { constants::directions<int>[i] } });
+    }
+    return edges;
+}
+bool
+find_corridor_route(const glm::ivec2& start, const glm::ivec2& target, std::vector<glm::ivec2>& route, unsigned* expansions = nullptr) {
+    auto& corridors = global_state.map.corridors;
+    
+    route.clear( );
+    if(expansions) *expansions = 0;
+    if(start == target) return true;
+    update_corridors( );
+    update_landmarks( );
+    
+    point_id_t start_id = point_id(start);
+    point_id_t target_id = point_id(target);
+    
+    // Rooms inside a corridor join the graph through the corridor ends
+    std::vector<corridor_edge> start_edges;
+    bool start_interior = corridors.interior.count(start_id);
+    if(start_interior) start_edges = corridor_edges_from(global_state.map.rooms.at(start_id), target_id);
+    std::map<point_id_t, corridor_edge> target_edges;
+    if(corridors.interior.count(target_id)) target_edges = corridor_edges_into(global_state.map.rooms.at(target_id), start_id);
+    
+    auto hops = [&](point_id_t point) {
+        return std::max(calc_heuristic(point_position(point), target), calc_landmark_heuristic(point, target_id));
+    };
+    
+    // Single steps are kept alive here since the labels point at the edge that reached them
+    std::deque<corridor_edge> steps;
+    std::map<point_id_t, corridor_label> labels;
+    std::priority_queue<queued_point> points;
+    labels[start_id] = { };
+    points.emplace(hops(start_id) * 2, 0, start_id);
+    
+    while(!points.empty( )) {
+        auto pi = points.top( ).point;
+        points.pop( );
+        
+        auto& label = labels[pi];
+        if(label.closed) continue;
+        label.closed = true;
+        if(expansions) (*expansions)++;
+        if(pi == target_id) break;
+        
+        auto relax = [&](const corridor_edge& edge) {
+            unsigned length = label.path_length + (unsigned) edge.steps.size( );
+            unsigned n_hops = hops(edge.junction);
+            if(length + n_hops > constants::map::route_length) return;
+            
+            unsigned cost = label.cost + edge.cost;
+            auto [next, inserted] = labels.try_emplace(edge.junction);
+            if(!inserted && (next->second.closed || next->second.cost <= cost)) return;
+            next->second = { cost, length, &edge, pi, false };
+            points.emplace(cost + n_hops * 2, cost, edge.junction);
+        };
+        
+        // Unexplored cells and rooms entered from the side of a corridor are searched room by room like find_route does
+        if(pi == start_id && start_interior) {
+            for(const auto& edge: start_edges) relax(edge);
+        } else {
+            auto junction = corridors.junctions.find(pi);
+            if(junction != std::end(corridors.junctions))
+                for(const auto& edge: junction->second) relax(edge);
+            for(auto& edge: room_steps(pi, false)) relax(steps.emplace_back(std::move(edge)));
+        }
+        auto into = target_edges.find(pi);
+        if(into != std::end(target_edges)) relax(into->second);
+    }
+    
+    auto found = labels.find(target_id);
+    if(found == std::end(labels) || !found->second.closed) return false;
+    
+    // Expand the corridors back into single room steps leading from the target to the start
+    for(point_id_t point = target_id; point != start_id;) {
+        const corridor_label& label = labels.at(point);
+        for(auto step = label.edge->steps.rbegin( ); step != label.edge->steps.rend( ); step++)
+            route.push_back(-*step);
+        point = label.parent;
+    }
+    return true;
+}
+void
+build_route_rows(const std::vector<unsigned>& rows) {
+    auto& table = global_state.map.route_table;
+    auto count = (unsigned) table.junctions.size( );
+    
+    // Rows only read the shared edges and write their own slice so they can run on every core
+    std::atomic<unsigned> next_row { 0 };
+    auto worker = [&]( ) {
+        std::priority_queue<std::pair<unsigned, unsigned>, std::vector<std::pair<unsigned, unsigned>>, std::greater<>> points;
+        for(unsigned r; (r = next_row++) < rows.size( );) {
+            unsigned source = rows[r];
+            unsigned* costs = table.costs.data( ) + (size_t) source * count;
+            std::fill(costs, costs + count, constants::map::route_unreachable);
+            
+            costs[source] = 0;
+            points.emplace(0, source);
+            while(!points.empty( )) {
+                auto [cost, u] = points.top( );
+                points.pop( );
+                if(cost != costs[u]) continue;
+                for(auto [v, weight]: table.edges[u]) {
+                    if(cost + weight >= costs[v]) continue;
+                    costs[v] = cost + weight;
+                    points.emplace(costs[v], v);
+                }
+            }
+        }
+    };
+    
+    std::vector<std::thread> threads;
+    unsigned thread_count = std::min<unsigned>(std::max(std::thread::hardware_concurrency( ), 1u), (unsigned) rows.size( ));
+    for(unsigned i = 1; i < thread_count; i++) threads.emplace_back(worker);
+    worker( );
+    for(auto& thread: threads) thread.join( );
+}
+void
+relax_route_table(unsigned u, unsigned v, unsigned weight) {
+    auto& table = global_state.map.route_table;
+    auto count = (unsigned) table.junctions.size( );
+    
+    // A new or cheaper corridor u to v can only shorten routes that pass through it
+    const unsigned* from_v = table.costs.data( ) + (size_t) v * count;
+    for(unsigned i = 0; i < count; i++) {
+        unsigned* costs = table.costs.data( ) + (size_t) i * count;
+        if(costs[u] == constants::map::route_unreachable) continue;
+        for(unsigned j = 0; j < count; j++) {
+            if(from_v[j] == constants::map::route_unreachable) continue;
+            costs[j] = std::min(costs[j], costs[u] + weight + from_v[j]);
+        }
+    }
+}
+void
+clear_route_slot(unsigned slot) {
+    auto& table = global_state.map.route_table;
+    auto count = (unsigned) table.junctions.size( );
+    
+    for(unsigned i = 0; i < count; i++) {
+        table.costs[(size_t) slot * count + i] = constants::map::route_unreachable;
+        table.costs[(size_t) i * count + slot] = constants::map::route_unreachable;
+    }
+    table.costs[(size_t) slot * count + slot] = 0;
+    table.edges[slot].clear( );
+}
+void
+grow_route_table( ) {
+    auto& table = global_state.map.route_table;
+    auto count = (unsigned) table.junctions.size( );
+    auto grown = std::max(count * 2, 16u);
+    
+    // Rows move to the wider stride, the new slots start out unreachable
+    std::vector<unsigned> costs((size_t) grown * grown, constants::map::route_unreachable);
+    for(unsigned i = 0; i < count; i++)
+        std::copy_n(table.costs.data( ) + (size_t) i * count, count, costs.data( ) + (size_t) i * grown);
+    for(unsigned i = count; i < grown; i++) costs[(size_t) i * grown + i] = 0;
+    table.costs = std::move(costs);
+    
+    table.junctions.resize(grown);
+    table.edges.resize(grown);
+    for(unsigned i = grown; i-- > count;) table.free.push_back(i);
+}
+void
+update_route_table( ) {
+    auto& corridors = global_state.map.corridors;
+    auto& table = global_state.map.route_table;
+    update_corridors( );
+    if(!table.stale) return;
+    table.stale = false;
+    
+#if ROUTE_STATISTICS
+    auto begin = std::chrono::steady_clock::now( );
+#endif
+    // Cheapest corridor between neighboring junctions of the current graph
+    std::map<point_id_t, std::map<point_id_t, unsigned>> weights;
+    for(const auto& [point, edges]: corridors.junctions) {
+        auto& row = weights[point];
+        for(const auto& edge: edges) {
+            auto [found, inserted] = row.try_emplace(edge.junction, edge.cost);
+            if(!inserted) found->second = std::min(found->second, edge.cost);
+        }
+    }
+    auto weight = [&](point_id_t u, point_id_t v) {
+        auto found = weights.at(u).find(v);
+        return found == std::end(weights.at(u)) ? constants::map::route_unreachable : found->second;
+    };
+    
+    std::vector<unsigned> removed;
+    for(const auto& [point, slot]: table.index)
+        if(!corridors.junctions.count(point)) removed.push_back(slot);
+    
+    // A corridor between kept junctions that was removed or got more expensive can lengthen any route
+    bool rebuild = table.index.empty( );
+    for(const auto& [point, slot]: table.index) {
+        if(rebuild) break;
+        if(!corridors.junctions.count(point)) continue;
+        for(auto [v, cost]: table.edges[slot]) {
+            point_id_t end = table.junctions[v];
+            if(corridors.junctions.count(end) && weight(point, end) > cost) rebuild = true;
+        }
+    }
+    // Routes through a removed junction survive if the corridors on both sides were merged into one that is no more expensive,
+    // which is what happens when exploring turns a dead end into a corridor room
+    for(unsigned x: removed) {
+        if(rebuild) break;
+        for(auto [u, into]: table.edges[x]) {
+            if(!corridors.junctions.count(table.junctions[u])) rebuild = true;
+            for(auto [v, out]: table.edges[x]) {
+                if(u == v || rebuild) continue;
+                unsigned cost = table.edges[u].count(x) ? table.edges[u].at(x) : constants::map::route_unreachable;
+                if(cost == constants::map::route_unreachable) continue;
+                if(weight(table.junctions[u], table.junctions[v]) > cost + out) rebuild = true;
+            }
+        }
+    }
+    
+    std::vector<std::tuple<unsigned, unsigned, unsigned>> cheaper;
+    if(!rebuild) {
+        for(unsigned x: removed) {
+            for(auto [v, cost]: table.edges[x]) table.edges[v].erase(x);
+            table.index.erase(table.junctions[x]);
+            clear_route_slot(x);
+            table.free.push_back(x);
+        }
+        for(const auto& item: corridors.junctions) {
+            if(table.index.count(item.first)) continue;
+            if(table.free.empty( )) grow_route_table( );
+            unsigned slot = table.free.back( );
+            table.free.pop_back( );
+            table.junctions[slot] = item.first;
+            table.index[item.first] = slot;
+        }
+        
+        // New and cheaper corridors are patched into the table in place
+        for(const auto& [point, row]: weights) {
+            unsigned u = table.index.at(point);
+            for(auto [end, cost]: row) {
+                unsigned v = table.index.at(end);
+                auto [found, inserted] = table.edges[u].try_emplace(v, cost);
+                if(!inserted && found->second <= cost) continue;
+                found->second = cost;
+                cheaper.emplace_back(u, v, cost);
+            }
+        }
+        rebuild = cheaper.size( ) > table.index.size( ) / 4;
+    }
+    
+    if(rebuild) {
+        table.junctions.clear( );
+        table.index.clear( );
+        table.free.clear( );
+        for(const auto& item: corridors.junctions) {
+            table.index[item.first] = (unsigned) table.junctions.size( );
+            table.junctions.push_back(item.first);
+        }
+        table.edges.assign(table.junctions.size( ), { });
+        for(const auto& [point, row]: weights)
+            for(auto [end, cost]: row) table.edges[table.index.at(point)][table.index.at(end)] = cost;
+        
+        table.costs.assign(table.junctions.size( ) * table.junctions.size( ), constants::map::route_unreachable);
+        std::vector<unsigned> rows(table.junctions.size( ));
+        for(unsigned i = 0; i < rows.size( ); i++) rows[i] = i;
+        build_route_rows(rows);
+    } else {
+        for(auto [u, v, cost]: cheaper) relax_route_table(u, v, cost);
+    }
+    
+    // Where routes can leave the corridors, find_table_route only trusts the table when none of these could be cheaper
+    table.exits.clear( );
+    for(const auto& [point, slot]: table.index)
+        for(const auto& edge: room_steps(point, false)) table.exits.emplace_back(slot, edge.junction);
+#if ROUTE_STATISTICS
+    auto time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now( ) - begin).count( );
+    std::cout << "Route table: " << table.index.size( ) << " junctions, " << (rebuild ? "rebuilt" : "patched") << " in " << time << " ms, "
+            << table.costs.capacity( ) * sizeof(unsigned) << " bytes" << std::endl;
+#endif
+}
+bool
+find_table_route(const glm::ivec2& start, const glm::ivec2& target, std::vector<glm::ivec2>& route) {
+    auto& corridors = global_state.map.corridors;
+    auto& table = global_state.map.route_table;
+    
+    route.clear( );
+    if(start == target) return true;
+    update_route_table( );
+    auto count = table.junctions.size( );
+    
+    point_id_t start_id = point_id(start);
+    point_id_t target_id = point_id(target);
+    auto start_room = global_state.map.rooms.find(start_id);
+    auto target_room = global_state.map.rooms.find(target_id);
+    if(start_room == std::end(global_state.map.rooms) || target_room == std::end(global_state.map.rooms)) return false;
+    
+    // Both ends join the table through their own junction or the junctions at the ends of their corridor
+    std::vector<corridor_edge> start_edges;
+    if(corridors.junctions.count(start_id)) start_edges.push_back({ start_id, 0, { } });
+    else if(corridors.interior.count(start_id)) start_edges = corridor_edges_from(start_room->second, target_id);
+    std::map<point_id_t, corridor_edge> target_edges;
+    if(corridors.junctions.count(target_id)) target_edges[target_id] = { target_id, 0, { } };
+    else if(corridors.interior.count(target_id)) target_edges = corridor_edges_into(target_room->second, start_id);
+    
+    unsigned best = constants::map::route_unreachable;
+    const corridor_edge* best_start = nullptr;
+    const corridor_edge* best_target = nullptr;
+    point_id_t best_end = target_id;
+    for(const auto& from: start_edges) {
+        // The corridor out of the start runs straight into the target
+        if(from.junction == target_id && from.cost < best) {
+            best = from.cost;
+            best_start = &from;
+            best_target = nullptr;
+        }
+        auto a = table.index.find(from.junction);
+        if(a == std::end(table.index)) continue;
+        for(const auto& [end, into]: target_edges) {
+            auto b = table.index.find(end);
+            if(b == std::end(table.index)) continue;
+            unsigned cost = table.costs[(size_t) a->second * count + b->second];
+            if(cost == constants::map::route_unreachable || from.cost + cost + into.cost >= best) continue;
+            best = from.cost + cost + into.cost;
+            best_start = &from;
+            best_target = &into;
+            best_end = end;
+        }
+    }
+    if(!best_start) return false;
+    
+    // A route leaving the corridors costs at least the way to the junction it leaves from, the step out and
+    // the cheapest possible step for every room still left to the target
+    if(!table.exits.empty( )) update_landmarks( );
+    for(auto [slot, exit]: table.exits) {
+        unsigned bound = constants::map::route_unreachable;
+        for(const auto& from: start_edges) {
+            auto a = table.index.find(from.junction);
+            if(a == std::end(table.index)) continue;
+            unsigned cost = table.costs[(size_t) a->second * count + slot];
+            if(cost != constants::map::route_unreachable) bound = std::min(bound, from.cost + cost);
+        }
+        if(bound == constants::map::route_unreachable) continue;
+        
+        unsigned hops = std::max(calc_heuristic(point_position(exit), target), calc_landmark_heuristic(exit, target_id));
+        if(bound + calc_step_cost(exit) + hops * 2 < best) return false;
+    }
+    
+    std::vector<glm::ivec2> steps = best_start->steps;
+    if(best_target) {
+        unsigned a = table.index.at(best_start->junction);
+        unsigned b = table.index.at(best_end);
+        while(a != b) {
+            // The next corridor is one that the rest of the route cost continues from
+            const corridor_edge* next = nullptr;
+            unsigned left = table.costs[(size_t) a * count + b];
+            for(const auto& edge: corridors.junctions.at(table.junctions[a])) {
+                unsigned cost = table.costs[(size_t) table.index.at(edge.junction) * count + b];
+                if(cost != constants::map::route_unreachable && edge.cost + cost == left && (!next || edge.cost < next->cost)) next = &edge;
+            }
+            steps.insert(std::end(steps), std::begin(next->steps), std::end(next->steps));
+            a = table.index.at(next->junction);
+        }
+        steps.insert(std::end(steps), std::begin(best_target->steps), std::end(best_target->steps));
+    }
+    
+    // Same direction as the other searches, leading from the target back to the start
+    for(auto step = steps.rbegin( ); step != steps.rend( ); step++)
+        route.push_back(-*step);
+    return true;
 }
 void
-push_path(const glm::ivec2& point, path_flag direction) {
-    unsigned position = global_state.map.path_size;
-    if(global_state.map.path_size == 10) {
-        position = global_state.map.path_head;
-        if(global_state.map.path_head == 9) global_state.map.path_head = 0;
-        else global_state.map.path_head++;
-    } else global_state.map.path_size++;
-    global_state.map.path[position] = { point, direction };
+find_portal_route(const glm::ivec2& position, std::vector<glm::ivec2>& route) {
+    route.clear( );
+    if(position == constants::zero<int>) return;
+    
+    // Routes through explored rooms use the corridor graph, the room grid is only searched when that fails
+    unsigned expansions = 0;
+    if(!find_corridor_route(position, constants::zero<int>, route, &expansions))
+        find_route(position, constants::zero<int>, route, &expansions);
+#if ROUTE_STATISTICS
+    std::vector<glm::ivec2> plain_route;
+    unsigned plain_expansions = 0;
+    find_route(position, constants::zero<int>, plain_route, &plain_expansions, false);
+    std::cout << "Route: " << expansions << " expansions, " << plain_expansions << " without landmarks" << std::endl;
+#endif
 }
-unsigned
-calc_heuristic(glm::ivec2 p) {
-    //auto dif = global_state.map.position - p;
-    return p.x * p.x + p.y * p.y /*+ dif.x * dif.x + dif.y * dif.y*/;
+void
+find_target_path( ) {
+    global_state.map.target_path.clear( );
+    if(!global_state.map.has_route_target) return;
+    
+#if ROUTE_STATISTICS
+    auto begin = std::chrono::steady_clock::now( );
+#endif
+    // The table is only used when no route leaving the corridors can beat it, the corridor search covers the rest
+    if(!find_table_route(active_player( ).position, global_state.map.route_target, global_state.map.target_path) &&
+            !find_corridor_route(active_player( ).position, global_state.map.route_target, global_state.map.target_path))
+        find_route(active_player( ).position, global_state.map.route_target, global_state.map.target_path);
+#if ROUTE_STATISTICS
+    auto time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now( ) - begin).count( );
+    std::cout << "Target route: " << global_state.map.target_path.size( ) << " rooms in " << time << " ms" << std::endl;
+#endif
 }
 void
-find_path( ) {
-    static constexpr glm::ivec2 directions[] { constants::south<int>, constants::east<int>, constants::north<int>, constants::west<int> };
+find_player_paths(const std::vector<player_data*>& players) {
+    if(players.empty( )) return;
+    if(players.size( ) == 1) {
+        find_portal_route(players.front( )->position, players.front( )->portal_path);
+        return;
+    }
+    auto& corridors = global_state.map.corridors;
+    update_corridors( );
+    
+    // Where each player joins the corridor graph
+    point_id_t portal_id = point_id(constants::zero<int>);
+    std::vector<std::vector<corridor_edge>> entries(players.size( ));
+    std::set<point_id_t> wanted;
+    for(size_t i = 0; i < players.size( ); i++) {
+        players[i]->portal_path.clear( );
+        if(players[i]->position == constants::zero<int>) continue;
+        
+        point_id_t point = point_id(players[i]->position);
+        if(corridors.interior.count(point)) entries[i] = corridor_edges_from(global_state.map.rooms.at(point), portal_id);
+        entries[i].push_back({ point, 0, { } });
+        for(const auto& entry: entries[i]) wanted.insert(entry.junction);
+    }
     
-    global_state.map.portal_path.clear( );
-    if(global_state.map.position == constants::zero<int>) return;
-    std::map<point_id_t, astar_point> point_data;
+    // A single search outward from the portal walks the corridors backwards until every player's corridor ends are settled
+    std::deque<corridor_edge> steps;
+    std::map<point_id_t, corridor_label> labels;
     std::priority_queue<queued_point> points;
-    
-    point_id_t start_id = point_id(global_state.map.position);
-    point_id_t end_id = point_id(constants::zero<int>);
-    
-    unsigned start_heuristic = calc_heuristic(global_state.map.position);
-    point_data[start_id] = { global_state.map.position, { }, 0, start_heuristic };
-    points.emplace(start_heuristic, start_id);
-    
-    bool found_portal = false;
-    unsigned max_length = 64;
-    while(!points.empty( )) {
+    labels[portal_id] = { };
+    points.emplace(0, 0, portal_id);
+    while(!points.empty( ) && !wanted.empty( )) {
         auto pi = points.top( ).point;
-        auto p = point_data[pi];
         points.pop( );
         
-        auto found = global_state.map.rooms.find(pi);
-        path_flag paths = path_flag::all;
-        if(found != std::end(global_state.map.rooms))
-            paths = found->second.paths;
+        auto& label = labels[pi];
+        if(label.closed) continue;
+        label.closed = true;
+        wanted.erase(pi);
         
-        if(p.path_length + 1 > max_length) continue;
-        for(int i = 0; i < 4; i++) {
-            if(!((unsigned) paths & (1 << i))) continue;
-            
-            auto dir = directions[i];
-            auto n = p.position + dir;
-            auto ni = point_id(n);
-            
-            if(std::abs(n.x) > constants::map::radius<unsigned> || std::abs(n.y) > constants::map::radius<unsigned>) continue;
-            
-            auto found_data = point_data.find(ni);
-            if(found_data != std::end(point_data)) {
-                if(p.path_length < found_data->second.path_length)
-                    found_data->second.parent_dir.emplace_back(-dir);
-                continue;
-            }
-            float scale = 1;
-            found = global_state.map.rooms.find(ni);
-            if(found != std::end(global_state.map.rooms)) {
-                if((unsigned) found->second.flags & (unsigned) room_flag::avoid)
-                    scale = 5;
-                else if(!found->second.visited)
-                    scale = 1.5f;
-            } else scale = 3;
-            
-            auto point_heuristic = (unsigned) ((float) calc_heuristic(n) * scale);
-            point_data[ni] = { n, { -dir }, p.path_length + 1, point_heuristic };
-            points.emplace(point_heuristic, ni);
-            
-            if((found_portal = ni == end_id))
-                max_length = p.path_length + 1;
+        auto relax = [&](const corridor_edge& edge, unsigned cost) {
+            unsigned length = label.path_length + (unsigned) edge.steps.size( );
+            if(length > constants::map::route_length) return;
             
-            //if((found_portal = ni == end_id)) break;
+            auto [next, inserted] = labels.try_emplace(edge.junction);
+            if(!inserted && (next->second.closed || next->second.cost <= cost)) return;
+            next->second = { cost, length, &edge, pi, false };
+            points.emplace(cost, cost, edge.junction);
+        };
+        
+        // Cost of the same corridor walked toward the portal, reversed single steps already cost the room they lead into
+        auto junction = corridors.junctions.find(pi);
+        if(junction != std::end(corridors.junctions))
+            for(const auto& edge: junction->second)
+                relax(edge, label.cost + edge.cost - calc_step_cost(edge.junction) + calc_step_cost(pi));
+        for(auto& edge: room_steps(pi, true)) {
+            const corridor_edge& step = steps.emplace_back(std::move(edge));
+            relax(step, label.cost + step.cost);
         }
-        //if(found_portal) break;
-    }
-    
-    auto found = point_data.find(end_id);
-    if(found != std::end(point_data)) {
-        auto pos = constants::zero<int>;
-        auto dest = found->second;
-        while(dest.path_length != 0) {
-            auto next = dest.parent_dir.front( );
-            for(const auto& item: dest.parent_dir) {
-                auto point_test = point_data.at(point_id(pos + item));
-                auto point_next = point_data.at(point_id(pos + next));
-                
-                //if(point_test.heuristic < point_next.heuristic)
-                //    next = item;
-                //else if(point_test.heuristic == point_next.heuristic)
-                if(point_test.path_length < point_next.path_length)
-                    next = item;
-            }
-            
-            global_state.map.portal_path.push_back(next);
-            pos += next;
-            dest = point_data.at(point_id(pos));
+    }
+    
+    for(size_t i = 0; i < players.size( ); i++) {
+        if(players[i]->position == constants::zero<int>) continue;
+        
+        const corridor_edge* best = nullptr;
+        unsigned best_cost = constants::map::route_unreachable;
+        for(const auto& entry: entries[i]) {
+            auto label = labels.find(entry.junction);
+            if(label == std::end(labels) || !label->second.closed) continue;
+            if(entry.steps.size( ) + label->second.path_length > constants::map::route_length) continue;
+            if(entry.cost + label->second.cost >= best_cost) continue;
+            best = &entry;
+            best_cost = entry.cost + label->second.cost;
+        }
+        if(!best) {
+            find_portal_route(players[i]->position, players[i]->portal_path);
+            continue;
+        }
+        
+        std::vector<const corridor_edge*> edges;
+        for(point_id_t point = best->junction; point != portal_id; point = labels.at(point).parent)
+            edges.push_back(labels.at(point).edge);
+        
+        auto& route = players[i]->portal_path;
+        for(auto edge = edges.rbegin( ); edge != edges.rend( ); edge++)
+            route.insert(std::end(route), std::begin((*edge)->steps), std::end((*edge)->steps));
+        for(auto step = best->steps.rbegin( ); step != best->steps.rend( ); step++)
+            route.push_back(-*step);
+    }
+}
+void
+find_path( ) {
+    auto begin = profile_clock( );
+    find_target_path( );
+    
+    // The active player's move may already have a speculated route, everyone else is routed together
+    bool speculated = false;
+    auto& speculation = global_state.map.speculation;
+    if(active_player( ).position != speculation.origin) {
+        for(auto& move: speculation.moves) {
+            if(!move.ready || move.position != active_player( ).position) continue;
+            std::swap(active_player( ).portal_path, move.route);
+            move.ready = false;
+            speculated = true;
+            break;
         }
+        if(speculated) speculation.hits++;
+        else speculation.misses++;
+#if ROUTE_STATISTICS
+        std::cout << "Speculation: " << speculation.hits << " of " << speculation.hits + speculation.misses << " moves" << std::endl;
+#endif
+    }
+    
+    std::vector<player_data*> players;
+    for(unsigned i = 0; i < global_state.map.players.size( ); i++)
+        if(i != global_state.map.active_player || !speculated) players.push_back(&global_state.map.players[i]);
+    find_player_paths(players);
+    profile_cpu(profile_timer::find_path, begin);
+}
+void
+speculate_routes( ) {
+    auto& speculation = global_state.map.speculation;
+    // Checked first since switching players moves the origin without a map change restarting the speculation
+    if(speculation.origin != active_player( ).position) {
+        for(auto& move: speculation.moves) move.ready = false;
+        speculation.origin = active_player( ).position;
+        speculation.next = 0;
+    }
+    if(global_state.map.pick_direction || speculation.next >= 4) return;
+    
+    // One route per call so input waiting behind it is only delayed by a single search
+    const room_data& room = global_state.map.rooms.at(point_id(active_player( ).position));
+    while(speculation.next < 4) {
+        unsigned i = speculation.next++;
+        auto& move = speculation.moves[i];
+        move.position = active_player( ).position + constants::directions<int>[i];
+        if(!((unsigned) room.paths & (1 << i)) || !in_map(move.position)) continue;
+        
+        find_portal_route(move.position, move.route);
+        move.ready = true;
+        return;
     }
 }
 
@@ -748,42 +2440,72 @@ main( ) {
     glfwMakeContextCurrent(global_state.window.handle);
     if(!gladLoadGLLoader((GLADloadproc) glfwGetProcAddress))
         throw std::runtime_error("Unable to load OpenGL context");
+    glfwSwapInterval(VSYNC);
     glEnable(GL_DEBUG_OUTPUT);
     glDebugMessageCallback(__detail::gl_debug_callback, nullptr);
     
     glfwSetKeyCallback(global_state.window.handle, keyboard_callback);
+    glfwSetMouseButtonCallback(global_state.window.handle, mouse_button_callback);
+    glfwSetFramebufferSizeCallback(global_state.window.handle, framebuffer_size_callback);
+    glfwSetWindowContentScaleCallback(global_state.window.handle, content_scale_callback);
+    glfwSetWindowRefreshCallback(global_state.window.handle, window_refresh_callback);
     build_gl_items( );
+    build_tile_sprites( );
+    build_expand_sprites( );
     
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glDisable(GL_DEPTH_TEST);
     
     glBindVertexArray(global_state.opengl.shader.arrays.quad_id);
-    glUseProgram(global_state.opengl.shader.program);
-    
-    screen_info screen { global_state.window.size };
-    glBindBuffer(GL_UNIFORM_BUFFER, global_state.opengl.shader.buffers.screen_info_id);
-    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(screen_info), &screen);
-    glBindBuffer(GL_UNIFORM_BUFFER, 0);
-    update_translation_position( );
-    update_translation_scale(global_state.map.scale);
+    use_program(global_state.opengl.shader.program);
+    
+    update_screen_info(global_state.window.size);
+    update_translation_scale(zoom_scale(global_state.map.scale));
+    global_state.map.camera.scale = global_state.map.target_view_scale;
+    start_view_move( );
     enable_translation(false);
     
+    // The window may not have the size it was asked for and starts on a monitor of any scale
+    int width, height;
+    float scale_x, scale_y;
+    glfwGetFramebufferSize(global_state.window.handle, &width, &height);
+    glfwGetWindowContentScale(global_state.window.handle, &scale_x, &scale_y);
+    framebuffer_size_callback(global_state.window.handle, width, height);
+    content_scale_callback(global_state.window.handle, scale_x, scale_y);
+    apply_window_changes( );
+    
     glfwShowWindow(global_state.window.handle);
+    double last_frame = 0;
     while(global_state.running) {
-        glfwWaitEvents( );
+        // The profiler and the overdraw view keep frames coming so their results are read back
+        bool animating = global_state.map.camera.moving || global_state.profiler.enabled || global_state.opengl.overdraw.enabled;
+        if(animating) {
+            // Sleeps until the next frame is due unless input comes first, with vsync the swap has usually taken that time already
+            double wait = last_frame + 1.0 / FRAME_RATE - glfwGetTime( );
+            if(wait > 0) glfwWaitEventsTimeout(wait);
+            else glfwPollEvents( );
+        }
+        // Routes for the next moves are computed while there is no input waiting
+        else if(global_state.map.speculation.next < 4 && !global_state.map.pick_direction) glfwPollEvents( );
+        else glfwWaitEvents( );
         if(glfwWindowShouldClose(global_state.window.handle))
             break;
         
-        if(global_state.discard && !global_state.queue_update) continue;
-        global_state.queue_update = false;
+        if(global_state.discard && !animating) {
+            speculate_routes( );
+            continue;
+        }
         //std::cout << "Update" << std::endl;
+        auto update_begin = profile_clock( );
         update( );
+        profile_cpu(profile_timer::update, update_begin);
         global_state.discard = true;
-        if(global_state.queue_update) glfwPostEmptyEvent( );
-        if(!global_state.redraw) continue;
+        if(!apply_window_changes( )) continue;
+        if(!global_state.redraw && !global_state.opengl.damage.pending && !animating) continue;
     
         //std::cout << "Render" << std::endl;
+        last_frame = glfwGetTime( );
         render( );
         glfwSwapBuffers(global_state.window.handle);
         global_state.redraw = false;
@@ -791,13 +2513,23 @@ main( ) {
     global_state.running = false;
     
     glBindVertexArray(0);
-    glUseProgram(0);
-    glBindTexture(GL_TEXTURE_2D, 0);
-    
-    glDeleteProgram(global_state.opengl.shader.program);
+    use_program(0);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    
+    for(auto fence: global_state.opengl.ring.fences) if(fence) glDeleteSync(fence);
+    for(auto [flags, program]: global_state.opengl.shader.variants) glDeleteProgram(program);
+    glDeleteProgram(global_state.opengl.shader.tile_program);
+    glDeleteProgram(global_state.opengl.shader.expand_program);
+    glDeleteProgram(global_state.opengl.shader.cull_program);
+    glDeleteProgram(global_state.opengl.shader.heatmap_program);
     glDeleteVertexArrays((GLsizei) constants::opengl::shader::arrays_count, (GLuint*) &global_state.opengl.shader.arrays);
     glDeleteBuffers((GLsizei) constants::opengl::shader::buffers_count, (GLuint*) &global_state.opengl.shader.buffers);
     glDeleteTextures((GLsizei) constants::opengl::textures_count, (GLuint*) &global_state.opengl.textures);
+    glDeleteSamplers((GLsizei) constants::opengl::samplers_count, (GLuint*) &global_state.opengl.samplers);
+    glDeleteFramebuffers((GLsizei) constants::opengl::framebuffers_count, (GLuint*) &global_state.opengl.framebuffers);
+#if FRAME_PROFILER
+    glDeleteQueries((GLsizei) (constants::profiler::frames * constants::profiler::stages), &global_state.profiler.queries[0][0]);
+#endif
     
     glfwTerminate( );
     for(int i = 0; i < constants::window::icon_count; i++) {
@@ -847,7 +2579,7 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
     static room_data dummy_room { constants::zero<int>, (path_flag) 0, room_flag::none, false };
     room_data* room = &dummy_room;
     if(!global_state.map.pick_direction)
-        room = &global_state.map.rooms.at(point_id(global_state.map.position));
+        room = &global_state.map.rooms.at(point_id(active_player( ).position));
     
     switch(key) {
     case GLFW_KEY_UP: {
@@ -861,16 +2593,17 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         }
         
         if(global_state.map.view_portal_room) DISCARD
-        if(global_state.map.position.y - 1 < -constants::map::radius<int>) DISCARD
+        if(active_player( ).position.y - 1 < -constants::map::radius<int>) DISCARD
         
         if(mods & GLFW_MOD_ALT) {
             if(room->flags == room_flag::portal) DISCARD
-            room_data* facing_room = &global_state.map.rooms[point_id(global_state.map.position + constants::north<int>)];
+            room_data* facing_room = &global_state.map.rooms[point_id(active_player( ).position + constants::north<int>)];
             if(facing_room->flags == room_flag::portal) DISCARD
             if(action == GLFW_RELEASE) return;
             
             (unsigned&) (room->paths) ^= (unsigned) path_flag::north;
             (unsigned&) (facing_room->paths) ^= (unsigned) path_flag::south;
+            map_changed(active_player( ).position, (unsigned) room->paths & (unsigned) path_flag::north);
             find_path( );
             global_state.redraw = true;
             return;
@@ -879,12 +2612,12 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         if(!((unsigned) room->paths & (unsigned) path_flag::north)) DISCARD
         if(action == GLFW_RELEASE) return;
         
-        global_state.map.position.y--;
-        push_path(global_state.map.position, path_flag::south);
+        active_player( ).position.y--;
+        push_path(active_player( ).position, path_flag::south);
         find_path( );
-        global_state.map.rooms.at(point_id(global_state.map.position)).visited = true;
-        add_surrounding_rooms(global_state.map.position);
-        global_state.map.target_view_position.y = global_state.map.position.y * -40;
+        global_state.map.rooms.at(point_id(active_player( ).position)).visited = true;
+        add_surrounding_rooms(active_player( ).position);
+        global_state.map.target_view_position.y = active_player( ).position.y * -40;
         global_state.redraw = true;
         break;
     }
@@ -899,16 +2632,17 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         }
         
         if(global_state.map.view_portal_room) DISCARD
-        if(global_state.map.position.y + 1 > constants::map::radius<int>) DISCARD
+        if(active_player( ).position.y + 1 > constants::map::radius<int>) DISCARD
         
         if(mods & GLFW_MOD_ALT) {
             if(room->flags == room_flag::portal) DISCARD
-            room_data* facing_room = &global_state.map.rooms[point_id(global_state.map.position + constants::south<int>)];
+            room_data* facing_room = &global_state.map.rooms[point_id(active_player( ).position + constants::south<int>)];
             if(facing_room->flags == room_flag::portal) DISCARD
             if(action == GLFW_RELEASE) return;
             
             (unsigned&) (room->paths) ^= (unsigned) path_flag::south;
             (unsigned&) (facing_room->paths) ^= (unsigned) path_flag::north;
+            map_changed(active_player( ).position, (unsigned) room->paths & (unsigned) path_flag::south);
             find_path( );
             global_state.redraw = true;
             return;
@@ -917,12 +2651,12 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         if(!((unsigned) room->paths & (unsigned) (path_flag::south))) DISCARD
         if(action == GLFW_RELEASE) return;
         
-        global_state.map.position.y++;
-        push_path(global_state.map.position, path_flag::north);
+        active_player( ).position.y++;
+        push_path(active_player( ).position, path_flag::north);
         find_path( );
-        global_state.map.rooms.at(point_id(global_state.map.position)).visited = true;
-        add_surrounding_rooms(global_state.map.position);
-        global_state.map.target_view_position.y = global_state.map.position.y * -40;
+        global_state.map.rooms.at(point_id(active_player( ).position)).visited = true;
+        add_surrounding_rooms(active_player( ).position);
+        global_state.map.target_view_position.y = active_player( ).position.y * -40;
         global_state.redraw = true;
         break;
     }
@@ -937,16 +2671,17 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         }
         
         if(global_state.map.view_portal_room) DISCARD
-        if(global_state.map.position.x - 1 < -constants::map::radius<int>) DISCARD
+        if(active_player( ).position.x - 1 < -constants::map::radius<int>) DISCARD
         
         if(mods & GLFW_MOD_ALT) {
             if(room->flags == room_flag::portal) DISCARD
-            room_data* facing_room = &global_state.map.rooms[point_id(global_state.map.position + constants::west<int>)];
+            room_data* facing_room = &global_state.map.rooms[point_id(active_player( ).position + constants::west<int>)];
             if(facing_room->flags == room_flag::portal) DISCARD
             if(action == GLFW_RELEASE) return;
             
             (unsigned&) (room->paths) ^= (unsigned) path_flag::west;
             (unsigned&) (facing_room->paths) ^= (unsigned) path_flag::east;
+            map_changed(active_player( ).position, (unsigned) room->paths & (unsigned) path_flag::west);
             find_path( );
             global_state.redraw = true;
             return;
@@ -955,12 +2690,12 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         if(!((unsigned) room->paths & (unsigned) path_flag::west)) DISCARD
         if(action == GLFW_RELEASE) return;
         
-        global_state.map.position.x--;
-        push_path(global_state.map.position, path_flag::east);
+        active_player( ).position.x--;
+        push_path(active_player( ).position, path_flag::east);
         find_path( );
-        global_state.map.rooms.at(point_id(global_state.map.position)).visited = true;
-        add_surrounding_rooms(global_state.map.position);
-        global_state.map.target_view_position.x = global_state.map.position.x * -40;
+        global_state.map.rooms.at(point_id(active_player( ).position)).visited = true;
+        add_surrounding_rooms(active_player( ).position);
+        global_state.map.target_view_position.x = active_player( ).position.x * -40;
         global_state.redraw = true;
         break;
     }
@@ -975,16 +2710,17 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         }
         
         if(global_state.map.view_portal_room) DISCARD
-        if(global_state.map.position.x + 1 > constants::map::radius<int>) DISCARD
+        if(active_player( ).position.x + 1 > constants::map::radius<int>) DISCARD
         
         if(mods & GLFW_MOD_ALT) {
             if(room->flags == room_flag::portal) DISCARD
-            room_data* facing_room = &global_state.map.rooms[point_id(global_state.map.position + constants::east<int>)];
+            room_data* facing_room = &global_state.map.rooms[point_id(active_player( ).position + constants::east<int>)];
             if(facing_room->flags == room_flag::portal) DISCARD
             if(action == GLFW_RELEASE) return;
             
             (unsigned&) (room->paths) ^= (unsigned) path_flag::east;
             (unsigned&) (facing_room->paths) ^= (unsigned) path_flag::west;
+            map_changed(active_player( ).position, (unsigned) room->paths & (unsigned) path_flag::east);
             find_path( );
             global_state.redraw = true;
             return;
@@ -993,12 +2729,12 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         if(!((unsigned) room->paths & (unsigned) path_flag::east)) DISCARD
         if(action == GLFW_RELEASE) return;
         
-        global_state.map.position.x++;
-        push_path(global_state.map.position, path_flag::west);
+        active_player( ).position.x++;
+        push_path(active_player( ).position, path_flag::west);
         find_path( );
-        global_state.map.rooms.at(point_id(global_state.map.position)).visited = true;
-        add_surrounding_rooms(global_state.map.position);
-        global_state.map.target_view_position.x = global_state.map.position.x * -40;
+        global_state.map.rooms.at(point_id(active_player( ).position)).visited = true;
+        add_surrounding_rooms(active_player( ).position);
+        global_state.map.target_view_position.x = active_player( ).position.x * -40;
         global_state.redraw = true;
         break;
     }
@@ -1010,7 +2746,7 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
             if(global_state.map.scale <= constants::map::min_scale) DISCARD
             if(action == GLFW_RELEASE) return;
             global_state.map.scale = std::max(global_state.map.scale - 1, constants::map::min_scale);
-            update_translation_scale(global_state.map.scale);
+            update_translation_scale(zoom_scale(global_state.map.scale));
             global_state.map.show_scale_meter = true;
             global_state.redraw = true;
             return;
@@ -1020,7 +2756,8 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         if(room->flags == room_flag::portal) DISCARD
         if(action == GLFW_RELEASE) return;
         room->flags = room->flags == room_flag::important_1 ? room_flag::none : room_flag::important_1;
-        global_state.redraw = true;
+        map_changed(active_player( ).position);
+        damage_room(active_player( ).position);
         break;
     }
     case GLFW_KEY_PAGE_UP: {
@@ -1031,7 +2768,7 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
             if(global_state.map.scale >= constants::map::max_scale) DISCARD
             if(action == GLFW_RELEASE) return;
             global_state.map.scale = std::min(global_state.map.scale + 1, constants::map::max_scale);
-            update_translation_scale(global_state.map.scale);
+            update_translation_scale(zoom_scale(global_state.map.scale));
             global_state.map.show_scale_meter = true;
             global_state.redraw = true;
             return;
@@ -1041,7 +2778,8 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         if(room->flags == room_flag::portal) DISCARD
         if(action == GLFW_RELEASE) return;
         room->flags = room->flags == room_flag::important_2 ? room_flag::none : room_flag::important_2;
-        global_state.redraw = true;
+        map_changed(active_player( ).position);
+        damage_room(active_player( ).position);
         break;
     }
     case GLFW_KEY_HOME: {
@@ -1055,7 +2793,7 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
             
             ULONG l = 1 & 0xFFFF | (71) << 16 | (1) << 24 | (1) << 29 | (1) << 30 | (1) << 31;
             SendMessage(global_state.window.hwnd, WM_KEYUP, (WPARAM) VK_HOME, (LPARAM) l);
-            global_state.redraw = true;
+            damage_window(global_keys_dot_position( ), global_keys_dot_size( ));
             return;
         }
         
@@ -1063,18 +2801,14 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         if(action == GLFW_REPEAT) DISCARD
         if(action == GLFW_PRESS) {
             global_state.map.target_view_position = constants::zero<int>;
-            
-            update_translation_position( );
-            update_translation_scale(1);
+            update_translation_scale(1.0f);
             global_state.map.view_portal_room = true;
             global_state.redraw = true;
             return;
         }
         
-        global_state.map.target_view_position = global_state.map.position * -40;
-        
-        update_translation_position( );
-        update_translation_scale(global_state.map.scale);
+        global_state.map.target_view_position = active_player( ).position * -40;
+        update_translation_scale(zoom_scale(global_state.map.scale));
         global_state.map.view_portal_room = false;
         global_state.redraw = true;
         break;
@@ -1094,6 +2828,46 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         if(room->flags == room_flag::portal) DISCARD
         if(action == GLFW_RELEASE) return;
         room->flags = room->flags == room_flag::avoid ? room_flag::none : room_flag::avoid;
+        map_changed(active_player( ).position);
+        damage_room(active_player( ).position);
+        break;
+    }
+    case GLFW_KEY_INSERT: {
+        if(global_state.show_help) DISCARD
+        if(global_state.map.view_portal_room) DISCARD
+        if(global_state.map.pick_direction) DISCARD
+        if(action == GLFW_RELEASE) return;
+        if(action != GLFW_PRESS) DISCARD
+        
+        if(mods & GLFW_MOD_ALT) {
+            // New players join at the portal
+            if(global_state.map.players.size( ) >= constants::map::player_count) DISCARD
+            global_state.map.players.emplace_back( );
+            global_state.map.active_player = (unsigned) global_state.map.players.size( ) - 1;
+        } else {
+            if(global_state.map.players.size( ) == 1) DISCARD
+            global_state.map.active_player = (global_state.map.active_player + 1) % global_state.map.players.size( );
+        }
+        
+        global_state.map.target_view_position = active_player( ).position * -40;
+        find_target_path( );
+        global_state.redraw = true;
+        break;
+    }
+    case GLFW_KEY_DELETE: {
+        if(global_state.show_help) DISCARD
+        if(global_state.map.view_portal_room) DISCARD
+        if(global_state.map.pick_direction) DISCARD
+        if(!(mods & GLFW_MOD_ALT)) DISCARD
+        if(action == GLFW_RELEASE) return;
+        if(action != GLFW_PRESS) DISCARD
+        if(global_state.map.players.size( ) == 1) DISCARD
+        
+        global_state.map.players.erase(std::begin(global_state.map.players) + global_state.map.active_player);
+        if(global_state.map.active_player == global_state.map.players.size( )) global_state.map.active_player--;
+        
+        global_state.map.target_view_position = active_player( ).position * -40;
+        find_target_path( );
         global_state.redraw = true;
         break;
     }
@@ -1107,6 +2881,40 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         global_state.redraw = true;
         break;
     }
+    case GLFW_KEY_F2: {
+        if(action != GLFW_PRESS) DISCARD
+        if(global_state.show_help) DISCARD
+        
+        global_state.map.tile_renderer = !global_state.map.tile_renderer;
+        global_state.redraw = true;
+        break;
+    }
+    case GLFW_KEY_F3: {
+        if(action != GLFW_PRESS) DISCARD
+        
+        // Queries still in flight are dropped, the averages start over
+        auto& profiler = global_state.profiler;
+        profiler.enabled = !profiler.enabled;
+        profiler.frame = 0;
+        profiler.stage = -1;
+        std::fill(std::begin(profiler.begun), std::end(profiler.begun), 0u);
+        std::fill(&profiler.samples[0][0], &profiler.samples[0][0] + constants::profiler::timers * constants::profiler::samples, 0.0f);
+        std::fill(std::begin(profiler.pending), std::end(profiler.pending), 0.0);
+        std::fill(std::begin(profiler.taken), std::end(profiler.taken), 0u);
+        global_state.redraw = true;
+        break;
+    }
+    case GLFW_KEY_F4: {
+        if(action != GLFW_PRESS) DISCARD
+        
+        auto& overdraw = global_state.opengl.overdraw;
+        overdraw.enabled = !overdraw.enabled;
+        if(overdraw.enabled) build_rect_variants(constants::opengl::instance::overdraw);
+        std::fill(std::begin(overdraw.counted), std::end(overdraw.counted), false);
+        if(!overdraw.enabled) glfwSetWindowTitle(global_state.window.handle, "Vault Mapper");
+        global_state.redraw = true;
+        break;
+    }
     case GLFW_KEY_ESCAPE: {
         global_state.running = false;
         break;
@@ -1115,6 +2923,62 @@ keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mod
     }
 }
 
+glm::ivec2
+window_to_room(double x, double y) {
+    // Inverse of the vertex shader translation, rooms are centered on their grid point
+    glm::vec2 half = (glm::vec2) global_state.window.size * 0.5f;
+    auto& camera = global_state.map.camera;
+    glm::vec2 position = (glm::vec2 { (float) x, (float) y } - half) / camera.scale - camera.position;
+    position += (float) constants::map::room_area / 2;
+    return { (int) std::floor(position.x / constants::map::room_area), (int) std::floor(position.y / constants::map::room_area) };
+}
+void
+framebuffer_size_callback(GLFWwindow*, int width, int height) {
+    global_state.window.pending_size = { (unsigned) width, (unsigned) height };
+    global_state.window.resized = true;
+}
+void
+content_scale_callback(GLFWwindow*, float x, float) {
+    global_state.window.pending_scale = x;
+    global_state.window.resized = true;
+}
+void
+window_refresh_callback(GLFWwindow* window) {
+    // Windows keeps its own event loop while the window is dragged, frames are drawn from here until it returns
+    if(!apply_window_changes( )) return;
+    global_state.redraw = true;
+    render( );
+    glfwSwapBuffers(window);
+    global_state.redraw = false;
+}
+void
+mouse_button_callback(GLFWwindow* window, int button, int action, int mods) {
+    if(action != GLFW_PRESS) return;
+    if(global_state.show_help || global_state.map.pick_direction || global_state.map.view_portal_room) return;
+    
+    if(button == GLFW_MOUSE_BUTTON_RIGHT) {
+        if(!global_state.map.has_route_target) return;
+        global_state.map.has_route_target = false;
+        global_state.map.target_path.clear( );
+    } else if(button == GLFW_MOUSE_BUTTON_LEFT) {
+        // The cursor is in screen coordinates, which differ from framebuffer pixels on scaled monitors
+        double x, y;
+        int width, height;
+        glfwGetCursorPos(window, &x, &y);
+        glfwGetWindowSize(window, &width, &height);
+        if(width == 0 || height == 0) return;
+        glm::ivec2 room = window_to_room(x * global_state.window.size.x / width, y * global_state.window.size.y / height);
+        if(!in_map(room) || global_state.map.rooms.find(point_id(room)) == std::end(global_state.map.rooms)) return;
+        
+        global_state.map.route_target = room;
+        global_state.map.has_route_target = true;
+        find_target_path( );
+    } else return;
+    
+    global_state.discard = false;
+    global_state.redraw = true;
+}
+
 void
 init_map(path_flag paths) {
     add_room({ 0, 0 }, paths, room_flag::portal);
@@ -1123,10 +2987,12 @@ init_map(path_flag paths) {
 }
 void
 reset_map( ) {
-    global_state.map.position = { 0, 0 };
+    global_state.map.players.assign(1, { });
+    global_state.map.active_player = 0;
     global_state.map.view_position = { 0, 0 };
     global_state.map.target_view_position = { 0, 0 };
-    update_translation_position( );
+    global_state.map.camera.position = { 0, 0 };
+    start_view_move( );
     
     global_state.map.view_portal_room = false;
     
@@ -1134,10 +3000,31 @@ reset_map( ) {
     
     global_state.map.pick_direction = true;
     
-    global_state.map.path_head = 0;
-    global_state.map.path_size = 0;
+    global_state.map.landmarks.positions.clear( );
+    global_state.map.landmarks.distances.clear( );
+    global_state.map.landmarks.stale = true;
+    
+    global_state.map.corridors.junctions.clear( );
+    global_state.map.corridors.interior.clear( );
+    global_state.map.corridors.dirty.clear( );
+    
+    for(auto& move: global_state.map.speculation.moves) move.ready = false;
+    global_state.map.speculation.origin = constants::zero<int>;
+    global_state.map.speculation.next = 4;
     
-    global_state.map.portal_path.clear( );
+    global_state.map.has_route_target = false;
+    global_state.map.target_path.clear( );
+    global_state.map.route_table = { };
+    
+    // The instance buffer keeps its storage for the next map
+    global_state.map.layer.slots.clear( );
+    global_state.map.layer.positions.clear( );
+    global_state.map.layer.dirty.clear( );
+    
+    global_state.map.tiles.dirty.clear( );
+    global_state.map.tiles.clear = true;
+    global_state.map.cache.stale = true;
+    global_state.map.minimap = { };
 }
 
 namespace textures {
@@ -1174,6 +3061,7 @@ namespace textures {
     
     inline constexpr uv_quad yellow { { 0.5f, 0.0f }, { 0.03125f, 0.03125f } };
     inline constexpr uv_quad red { { 0.5f, 0.0625f }, { 0.03125f, 0.03125f } };
+    inline constexpr uv_quad green { { 0.53125f, 0.0f }, { 0.03125f, 0.03125f } };
     
     inline constexpr uv_quad bar_on { { 0.625f, 0.0f }, { 0.0625f, 0.0625f } };
     inline constexpr uv_quad bar_off { { 0.625f, 0.0625f }, { 0.0625f, 0.0625f } };
@@ -1202,51 +3090,336 @@ namespace textures {
     };
 }
 
+void
+build_tile_sprites( ) {
+    GLuint program = global_state.opengl.shader.tile_program;
+    auto sprite_vec = [](const uv_quad& uv) { return glm::vec4 { uv.position.x, uv.position.y, uv.size.x, uv.size.y }; };
+    
+    glm::vec4 rooms[32];
+    glm::uint transforms[32];
+    for(unsigned i = 0; i < 32; i++) {
+        rooms[i] = sprite_vec(textures::mapped_rooms[i].uv);
+        transforms[i] = (glm::uint) textures::mapped_rooms[i].translation;
+    }
+    glProgramUniform4fv(program, glGetUniformLocation(program, "room_sprites"), 32, (GLfloat*) rooms);
+    glProgramUniform1uiv(program, glGetUniformLocation(program, "room_transforms"), 32, transforms);
+    
+    // Order matches the marker bits of 'room_state'
+    glm::vec4 markers[] {
+            sprite_vec(textures::marker_red),
+            sprite_vec(textures::marker_yellow),
+            sprite_vec(textures::marker_green)
+    };
+    glProgramUniform4fv(program, glGetUniformLocation(program, "marker_sprites"), 3, (GLfloat*) markers);
+    
+    glm::vec4 paths[] {
+            sprite_vec(textures::visited_path_down),
+            sprite_vec(textures::unvisited_path_down_transition),
+            sprite_vec(textures::unvisited_path_down),
+            sprite_vec(textures::unvisited_path_down_end),
+            sprite_vec(textures::visited_path_right),
+            sprite_vec(textures::unvisited_path_right_transition),
+            sprite_vec(textures::unvisited_path_right),
+            sprite_vec(textures::unvisited_path_right_end)
+    };
+    glProgramUniform4fv(program, glGetUniformLocation(program, "path_sprites"), 8, (GLfloat*) paths);
+}
+std::uint8_t
+room_state(const room_data& room) {
+    // Paths in the low four bits, then visited, the marker and if the room is known, the portal is always at the origin
+    unsigned marker = 0;
+    if(room.flags == room_flag::avoid) marker = 1;
+    else if(room.flags == room_flag::important_1) marker = 2;
+    else if(room.flags == room_flag::important_2) marker = 3;
+    return (std::uint8_t) ((unsigned) room.paths | room.visited << 4 | marker << 5 | 0x80);
+}
+std::array<std::uint8_t, 4>
+room_color(const room_data& room) {
+    // Markers first, then the portal, visited and seen rooms
+    if(room.flags == room_flag::avoid) return { 0xD0, 0x30, 0x30, 0xFF };
+    if(room.flags == room_flag::important_1) return { 0xE0, 0xC0, 0x30, 0xFF };
+    if(room.flags == room_flag::important_2) return { 0x40, 0xB0, 0x40, 0xFF };
+    if(room.flags == room_flag::portal) return { 0x80, 0x50, 0xD0, 0xFF };
+    if(room.visited) return { 0xC8, 0xC8, 0xC8, 0xFF };
+    return { 0x70, 0x70, 0x70, 0xFF };
+}
+void
+update_room_states( ) {
+    auto& tiles = global_state.map.tiles;
+    if(!tiles.clear && tiles.dirty.empty( )) return;
+    
+    if(tiles.clear) {
+        std::uint8_t zero[4] { };
+        glClearTexImage(global_state.opengl.textures.room_state_id, 0, GL_RED_INTEGER, GL_UNSIGNED_BYTE, zero);
+        glClearTexImage(global_state.opengl.textures.map_overview_id, 0, GL_RGBA, GL_UNSIGNED_BYTE, zero);
+        tiles.clear = false;
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for(point_id_t point: tiles.dirty) {
+        auto room = global_state.map.rooms.find(point);
+        if(room == std::end(global_state.map.rooms)) continue;
+        
+        glm::ivec2 cell = room->second.position + constants::map::radius<int>;
+        std::uint8_t state = room_state(room->second);
+        bind_texture(2, GL_TEXTURE_2D, global_state.opengl.textures.room_state_id);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, cell.x, cell.y, 1, 1, GL_RED_INTEGER, GL_UNSIGNED_BYTE, &state);
+        auto color = room_color(room->second);
+        bind_texture(4, GL_TEXTURE_2D, global_state.opengl.textures.map_overview_id);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, cell.x, cell.y, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, color.data( ));
+    }
+    tiles.dirty.clear( );
+    tiles.overview_mips = true;
+}
+void
+update_overview_mips( ) {
+    // The chunk thumbnails are rebuilt from the rooms, only once something draws from them
+    auto& tiles = global_state.map.tiles;
+    if(!tiles.overview_mips) return;
+    tiles.overview_mips = false;
+    bind_texture(4, GL_TEXTURE_2D, global_state.opengl.textures.map_overview_id);
+    glGenerateMipmap(GL_TEXTURE_2D);
+}
+
 void
 update( ) {
-    if(global_state.map.view_position != global_state.map.target_view_position) {
-        bool x_less = global_state.map.view_position.x < global_state.map.target_view_position.x;
-        bool y_less = global_state.map.view_position.y < global_state.map.target_view_position.y;
-        glm::vec2 pos = glm::mix((glm::vec2) global_state.map.view_position, (glm::vec2) global_state.map.target_view_position, 0.1f);
-        
-        global_state.map.view_position = glm::ivec2((int) (x_less ? std::ceil(pos.x) : std::floor(pos.x)), (int) (y_less ? std::ceil(pos.y) : std::floor(pos.y)));
-        global_state.queue_update = true;
-        global_state.redraw = true;
-        update_translation_position( );
+    auto& camera = global_state.map.camera;
+    if(camera.target != global_state.map.target_view_position || camera.target_scale != global_state.map.target_view_scale) start_view_move( );
+    if(!camera.moving) return;
+    
+    // Eased out by wall clock time so a move takes as long however often this runs, the shaders do the same from the time uniform
+    double t = std::min((glfwGetTime( ) - camera.start_time) / constants::map::camera_duration, 1.0);
+    auto eased = (float) (1 - (1 - t) * (1 - t) * (1 - t));
+    camera.position = glm::mix(camera.start, (glm::vec2) camera.target, eased);
+    camera.scale = glm::mix(camera.start_scale, camera.target_scale, eased);
+    if(t >= 1) {
+        camera.position = camera.target;
+        camera.scale = camera.target_scale;
+        camera.moving = false;
     }
+    global_state.map.view_position = glm::ivec2((int) std::round(camera.position.x), (int) std::round(camera.position.y));
+    global_state.redraw = true;
 }
 
 inline void
-bind_texture(GLuint id) {
-    glBindTexture(GL_TEXTURE_2D, id);
+bind_layer(texture_layer layer) {
+    global_state.opengl.frame.layer = layer;
+}
+void
+begin_instance_frame( ) {
+    auto& ring = global_state.opengl.ring;
+    GLsync& fence = ring.fences[ring.region];
+    if(!fence) return;
+    
+    // Wait for the GPU to finish reading the region from the last time it was used
+    while(glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED);
+    glDeleteSync(fence);
+    fence = nullptr;
+    
+    // The culled map draw of that frame is complete, its instance count is what survived
+    auto& cull = global_state.opengl.cull;
+    if(cull.commands[ring.region] < 0) return;
+    cull.rooms = cull.submitted[ring.region];
+    cull.visible = ring.commands[ring.region * constants::opengl::ring::region_commands + cull.commands[ring.region]].instance_count;
+    cull.commands[ring.region] = -1;
+}
+void
+submit_draws( ) {
+    auto& ring = global_state.opengl.ring;
+    flush_uniforms( );
+    
+    // Commands are kept in order so blending is unchanged, each run with the same flags is one draw call with its variant
+    while(ring.command_first != ring.command_head) {
+        unsigned flags = ring.command_flags[ring.command_first];
+        unsigned last = ring.command_first + 1;
+        while(last != ring.command_head && ring.command_flags[last] == flags) last++;
+        
+        // Draws into the map cache are not part of the frame and not counted
+        if(global_state.opengl.overdraw.enabled && global_state.opengl.state.draw_framebuffer == global_state.opengl.framebuffers.frame_id)
+            flags |= constants::opengl::instance::overdraw;
+        use_program(variant_program(flags));
+        GLintptr offset = sizeof(draw_command) * (ring.region * constants::opengl::ring::region_commands + ring.command_first);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (void*) offset, (GLsizei) (last - ring.command_first), 0);
+        ring.command_first = last;
+        global_state.opengl.frame.draw_calls++;
+    }
+}
+void
+end_instance_frame( ) {
+    auto& ring = global_state.opengl.ring;
+    submit_draws( );
+    ring.fences[ring.region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    ring.region = (ring.region + 1) % constants::opengl::ring::regions;
+    ring.head = 0;
+    ring.command_head = 0;
+    ring.command_first = 0;
+    
+#if RENDER_STATISTICS
+    auto& frame = global_state.opengl.frame;
+    std::cout << "Frame: " << frame.draws << " draws in " << frame.draw_calls << " draw calls, " << frame.state_changes << " state changes" << std::endl;
+    auto& cull = global_state.opengl.cull;
+    auto& state = global_state.opengl.state;
+    std::cout << "State: " << state.elided << " calls elided, " << state.uniform_writes << " uniform writes in " << state.uniform_uploads << " uploads, "
+            << global_state.opengl.shader.variants.size( ) << " program variants" << std::endl;
+    std::cout << "Cull: " << cull.visible << " of " << cull.rooms * constants::map::room_slots << " map slots visible from " << cull.rooms << " rooms" << std::endl;
+#endif
+    global_state.opengl.frame.draws = 0;
+    global_state.opengl.frame.draw_calls = 0;
+    global_state.opengl.frame.state_changes = 0;
+    global_state.opengl.state.elided = 0;
+    global_state.opengl.state.uniform_writes = 0;
+    global_state.opengl.state.uniform_uploads = 0;
+}
+void
+profile_stage(profile_timer stage) {
+#if FRAME_PROFILER
+    auto& profiler = global_state.profiler;
+    if(!profiler.enabled) return;
+    
+    // Draws wait to be batched, what was recorded so far belongs to the stage before
+    submit_draws( );
+    if(profiler.stage >= 0) glEndQuery(GL_TIME_ELAPSED);
+    profiler.stage = (int) stage;
+    glBeginQuery(GL_TIME_ELAPSED, profiler.queries[profiler.frame][profiler.stage]);
+    profiler.begun[profiler.frame] |= 1u << profiler.stage;
+#endif
+}
+void
+profile_begin_frame( ) {
+#if FRAME_PROFILER
+    auto& profiler = global_state.profiler;
+    if(!profiler.enabled) return;
+    
+    // The queries of the oldest frame are reused now, their results are taken if the GPU has them and dropped otherwise
+    unsigned begun = profiler.begun[profiler.frame];
+    profiler.begun[profiler.frame] = 0;
+    if(begun == 0) return;
+    unsigned last = 0;
+    for(unsigned i = 0; i < constants::profiler::stages; i++) if(begun & (1u << i)) last = i;
+    GLint available = GL_FALSE;
+    glGetQueryObjectiv(profiler.queries[profiler.frame][last], GL_QUERY_RESULT_AVAILABLE, &available);
+    if(available == GL_FALSE) return;
+    
+    // Stages run one after another so the last being done means all are, stages the frame skipped are left out of the averages
+    for(unsigned i = 0; i < constants::profiler::stages; i++) {
+        if(!(begun & (1u << i))) continue;
+        GLuint64 time = 0;
+        glGetQueryObjectui64v(profiler.queries[profiler.frame][i], GL_QUERY_RESULT, &time);
+        profile_sample((profile_timer) i, (float) ((double) time / 1e6));
+    }
+#if PROFILER_CSV
+    if(!profiler.csv.is_open( )) {
+        profiler.csv.open("profile.csv", std::ios::trunc);
+        for(unsigned i = 0; i < constants::profiler::timers; i++) profiler.csv << (i ? "," : "") << constants::profiler::names[i];
+        profiler.csv << std::endl;
+    }
+    // The CPU timings are of the last frame, the GPU stages of the frame read back now
+    for(unsigned i = 0; i < constants::profiler::timers; i++) {
+        unsigned sample = (profiler.next[i] + constants::profiler::samples - 1) % constants::profiler::samples;
+        profiler.csv << (i ? "," : "");
+        if(i >= constants::profiler::stages || begun & (1u << i)) profiler.csv << profiler.samples[i][sample];
+    }
+    profiler.csv << "\n";
+#endif
+#endif
+}
+void
+profile_end_frame( ) {
+#if FRAME_PROFILER
+    auto& profiler = global_state.profiler;
+    if(!profiler.enabled) return;
+    
+    if(profiler.stage >= 0) glEndQuery(GL_TIME_ELAPSED);
+    profiler.stage = -1;
+    profiler.frame = (profiler.frame + 1) % constants::profiler::frames;
+    
+    // CPU time is summed over the frame and taken as one sample
+    for(unsigned i = constants::profiler::stages; i < constants::profiler::timers; i++) {
+        profile_sample((profile_timer) i, (float) profiler.pending[i]);
+        profiler.pending[i] = 0;
+    }
+#endif
+}
+unsigned
+reserve_instances(unsigned count) {
+    auto& ring = global_state.opengl.ring;
+    if(ring.head + count > ring.region_size) {
+        // Recorded draws still refer to the old ring
+        submit_draws( );
+        
+        unsigned region_size = ring.region_size;
+        while(region_size < count) region_size *= 2;
+        build_instance_ring(region_size * 2);
+        build_rect_array(global_state.opengl.shader.arrays.quad_id, global_state.opengl.shader.buffers.quad_instanced_pos_id);
+        glBindVertexArray(global_state.opengl.shader.arrays.quad_id);
+        global_state.opengl.frame.state_changes++;
+    }
+    
+    unsigned first = ring.region * ring.region_size + ring.head;
+    ring.head += count;
+    return first;
+}
+void
+record_draw(unsigned first, unsigned count, unsigned flags) {
+    auto& ring = global_state.opengl.ring;
+    if(ring.command_head == constants::opengl::ring::region_commands) throw std::runtime_error("Too many draws in one frame");
+    
+    ring.command_flags[ring.command_head] = flags;
+    ring.commands[ring.region * constants::opengl::ring::region_commands + ring.command_head++] =
+            { constants::quad_indices_count, count, 0, 0, first };
+    global_state.opengl.frame.draws++;
+}
+std::uint16_t
+sprite_id(const rect& r) {
+    auto& sprites = global_state.opengl.sprites;
+    auto key = std::make_tuple(r.dimensions.size.x, r.dimensions.size.y, r.texture.position.x, r.texture.position.y, r.texture.size.x, r.texture.size.y, r.layer);
+    auto found = sprites.index.find(key);
+    if(found != std::end(sprites.index)) return found->second;
+    if(sprites.index.size( ) == constants::opengl::sprite_count) throw std::runtime_error("Sprite table is full");
+    
+    // New sprites are rare, they are written to the table as they are first drawn
+    auto id = (std::uint16_t) sprites.index.size( );
+    sprite_data sprite { r.texture, r.dimensions.size, r.layer };
+    bind_buffer(GL_UNIFORM_BUFFER, global_state.opengl.shader.buffers.sprite_table_id);
+    glBufferSubData(GL_UNIFORM_BUFFER, (GLintptr) (sizeof(sprite_data) * id), sizeof(sprite_data), &sprite);
+    sprites.index.emplace(key, id);
+    return id;
+}
+rect_instance
+pack_rect(const rect& r) {
+    return { (std::int16_t) r.dimensions.position.x, (std::int16_t) r.dimensions.position.y, sprite_id(r), (std::uint8_t) r.uv_tr, (std::uint8_t) r.flags };
+}
+void
+draw_rect(const rect* rects, unsigned count) {
+    unsigned first = reserve_instances(count);
+    rect_instance* instances = global_state.opengl.ring.mapped + first;
+    for(unsigned i = 0; i < count; i++) {
+        rect r = rects[i];
+        r.layer = global_state.opengl.frame.layer;
+        r.flags = global_state.opengl.frame.flags;
+        instances[i] = pack_rect(r);
+    }
+    record_draw(first, count, global_state.opengl.frame.flags);
 }
 void
 draw_rect(const std::vector<rect>& rects) {
-    static unsigned rect_draw_buffer_size = 1;
     if(rects.empty( )) return;
-    
-    glBindBuffer(GL_ARRAY_BUFFER, global_state.opengl.shader.buffers.quad_instanced_pos_id);
-    if(rect_draw_buffer_size < rects.size( )) {
-        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr) (sizeof(rect) * rects.size( )), rects.data( ), GL_DYNAMIC_DRAW);
-        rect_draw_buffer_size = rects.size( );
-    } else
-        glBufferSubData(GL_ARRAY_BUFFER, 0, (GLsizeiptr) (sizeof(rect) * rects.size( )), rects.data( ));
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glDrawElementsInstanced(GL_TRIANGLES, constants::quad_indices_count, GL_UNSIGNED_INT, nullptr, (int) rects.size( ));
+    draw_rect(rects.data( ), (unsigned) rects.size( ));
 }
 void
 draw_rect(const rect& r) {
-    glBindBuffer(GL_ARRAY_BUFFER, global_state.opengl.shader.buffers.quad_instanced_pos_id);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, (GLsizeiptr) sizeof(rect), &r);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glDrawElementsInstanced(GL_TRIANGLES, constants::quad_indices_count, GL_UNSIGNED_INT, nullptr, 1);
+    draw_rect(&r, 1);
 }
 
+rect
+screen_rect(const uv_quad& texture) {
+    // Sized by the shader so every window size shares one sprite instead of adding an entry per resize
+    return rect { { constants::zero<int>, constants::opengl::screen_size }, texture, uv_translation::rot_0 };
+}
 void
 render_background( ) {
     enable_translation(false);
-    bind_texture(global_state.opengl.textures.background_id);
-    draw_rect(rect { { constants::zero<int>, global_state.window.size }, textures::all, uv_translation::rot_0 });
+    bind_layer(texture_layer::background);
+    draw_rect(screen_rect(textures::all));
 }
 void
 render_map_scale( ) {
@@ -1259,141 +3432,328 @@ render_map_scale( ) {
     }
     
     enable_translation(false);
-    bind_texture(global_state.opengl.textures.texture_id);
+    bind_layer(texture_layer::texture);
     draw_rect(bars);
 }
 void
-render_map( ) {
-    rect r { };
-    
-    enable_translation(true);
+profile_bar(std::vector<rect>& rects, glm::ivec2 position, unsigned length, const uv_quad& color) {
+    // Made of power of two pieces so the sprite table only ever holds a few bar sizes
+    length = std::min(length, 2047u);
+    for(unsigned piece = 1024; piece > 0; piece >>= 1) {
+        if(!(length & piece)) continue;
+        rects.push_back(rect { { position, { piece, constants::profiler::row_height } }, color, uv_translation::rot_0 });
+        position.x += (int) piece;
+    }
+}
+void
+render_profiler( ) {
+#if FRAME_PROFILER
+    auto& profiler = global_state.profiler;
+    if(!profiler.enabled) return;
     
+    // A row per 'profile_timer' with the average as a bar and the maximum as a tick, GPU stages in green above CPU timings in yellow,
+    // the red line is the time a frame has
     std::vector<rect> rects;
-    rects.reserve(global_state.map.rooms.size( ));
-    
-    for(const auto& item: global_state.map.rooms) {
-        rect room_rect { };
-        room_rect.dimensions.position = item.second.position;
-        (room_rect.dimensions.position *= 40) -= glm::ivec2(16);
-        room_rect.dimensions.size = { 32, 32 };
-        
-        unsigned index = (unsigned) item.second.paths | item.second.visited << 4;
-        auto room_view = textures::mapped_rooms[index];
-        room_rect.texture = room_view.uv;
-        room_rect.uv_tr = room_view.translation;
-        
-        rects.push_back(room_rect);
-        
-        if(item.second.flags != room_flag::none) {
-            if(item.second.flags == room_flag::important_1)
-                room_rect.texture = textures::marker_yellow;
-            else if(item.second.flags == room_flag::important_2)
-                room_rect.texture = textures::marker_green;
-            else if(item.second.flags == room_flag::avoid)
-                room_rect.texture = textures::marker_red;
-            
-            if(item.second.flags != room_flag::portal)
-                rects.push_back(room_rect);
-        }
-        
-        if((unsigned) (item.second.paths) & 0x1) {
-            glm::ivec2 down = item.second.position + glm::ivec2 { 0, 1 };
-            
-            rect path_rect { };
-            path_rect.dimensions.position = room_rect.dimensions.position + glm::ivec2(10, 32);
-            path_rect.dimensions.size = { 16, 8 };
-            path_rect.uv_tr = uv_translation::rot_0;
-            
-            auto found = global_state.map.rooms.find(point_id(down));
-            if(found != std::end(global_state.map.rooms)) {
-                if((unsigned) (found->second.paths) & 0x4) {
-                    bool visited = item.second.visited && found->second.visited;
-                    bool one_visited = item.second.visited || found->second.visited;
-                    
-                    bool other = found->second.visited;
-                    if(one_visited && other) path_rect.uv_tr = uv_translation::flip_vert;
-                    path_rect.texture = visited ? textures::visited_path_down : one_visited ? textures::unvisited_path_down_transition : textures::unvisited_path_down;
-                }
-            } else path_rect.texture = textures::unvisited_path_down_end;
-            
-            rects.push_back(path_rect);
-        }
-        
-        if((unsigned) (item.second.paths) & 0x2) {
-            glm::ivec2 right = item.second.position + glm::ivec2 { 1, 0 };
-            
-            rect path_rect { };
-            path_rect.dimensions.position = room_rect.dimensions.position + glm::ivec2(32, 10);
-            path_rect.dimensions.size = { 8, 16 };
-            path_rect.uv_tr = uv_translation::rot_0;
-            
-            auto found = global_state.map.rooms.find(point_id(right));
-            if(found != std::end(global_state.map.rooms)) {
-                if((unsigned) (found->second.paths) & 0x8) {
-                    bool visited = item.second.visited && found->second.visited;
-                    bool one_visited = item.second.visited || found->second.visited;
-                    bool other = found->second.visited;
-                    if(one_visited && other) path_rect.uv_tr = uv_translation::flip_hori;
-                    path_rect.texture = visited ? textures::visited_path_right : one_visited ? textures::unvisited_path_right_transition : textures::unvisited_path_right;
-                }
-            } else path_rect.texture = textures::unvisited_path_right_end;
-            
-            rects.push_back(path_rect);
-        }
-        
-        if((unsigned) (item.second.paths) & 0x4) {
-            glm::ivec2 up = item.second.position + glm::ivec2 { 0, -1 };
-            
-            auto found = global_state.map.rooms.find(point_id(up));
-            if(found == std::end(global_state.map.rooms)) {
-                rect path_rect { };
-                path_rect.dimensions.position = room_rect.dimensions.position + glm::ivec2(10, -8);
-                path_rect.dimensions.size = { 16, 8 };
-                path_rect.uv_tr = uv_translation::flip_vert;
-                path_rect.texture = textures::unvisited_path_down_end;
-                rects.push_back(path_rect);
-            }
-        }
-        
-        if((unsigned) (item.second.paths) & 0x8) {
-            glm::ivec2 left = item.second.position + glm::ivec2 { -1, 0 };
-            
-            auto found = global_state.map.rooms.find(point_id(left));
-            if(found == std::end(global_state.map.rooms)) {
-                rect path_rect { };
-                path_rect.dimensions.position = room_rect.dimensions.position + glm::ivec2(-8, 10);
-                path_rect.dimensions.size = { 8, 16 };
-                path_rect.uv_tr = uv_translation::flip_hori;
-                path_rect.texture = textures::unvisited_path_right_end;
-                rects.push_back(path_rect);
-            }
+    constexpr glm::ivec2 origin { 12, 56 };
+    int width = (int) global_state.window.size.x - 2 * origin.x;
+    glm::ivec2 position = origin;
+    for(unsigned i = 0; i < constants::profiler::timers; i++) {
+        float sum = 0, max = 0;
+        for(float sample: profiler.samples[i]) {
+            sum += sample;
+            max = std::max(max, sample);
         }
-        
+        auto average = profiler.taken[i] ? (int) (sum / (float) profiler.taken[i] * constants::profiler::pixels_per_ms) : 0;
+        profile_bar(rects, position, (unsigned) std::clamp(average, 0, width), i < constants::profiler::stages ? textures::green : textures::yellow);
+        auto tick = std::clamp((int) (max * constants::profiler::pixels_per_ms), 0, width);
+        rects.push_back(rect { { { position.x + tick, position.y }, { 1, constants::profiler::row_height } }, textures::red, uv_translation::rot_0 });
+        position.y += constants::profiler::row_height + (i + 1 == constants::profiler::stages ? 6 : 2);
     }
+    auto budget = std::min((int) (1000.0f / FRAME_RATE * constants::profiler::pixels_per_ms), width);
+    rects.push_back(rect { { { origin.x + budget, origin.y }, { 1, position.y - origin.y } }, textures::red, uv_translation::rot_0 });
     
-    bind_texture(global_state.opengl.textures.texture_id);
+    enable_translation(false);
+    bind_layer(texture_layer::texture);
     draw_rect(rects);
+#endif
+}
+void
+build_expand_sprites( ) {
+    GLuint program = global_state.opengl.shader.expand_program;
+    auto sprite = [](const glm::uvec2& size, const uv_quad& uv) { return (glm::uint) sprite_id(rect { { { 0, 0 }, size }, uv }); };
+    
+    glm::uint rooms[32];
+    glm::uint transforms[32];
+    for(unsigned i = 0; i < 32; i++) {
+        rooms[i] = sprite({ 32, 32 }, textures::mapped_rooms[i].uv);
+        transforms[i] = (glm::uint) textures::mapped_rooms[i].translation;
+    }
+    glProgramUniform1uiv(program, glGetUniformLocation(program, "room_sprites"), 32, rooms);
+    glProgramUniform1uiv(program, glGetUniformLocation(program, "room_transforms"), 32, transforms);
+    
+    // Order matches the marker bits of 'room_state'
+    glm::uint markers[] { sprite({ 32, 32 }, textures::marker_red), sprite({ 32, 32 }, textures::marker_yellow), sprite({ 32, 32 }, textures::marker_green) };
+    glProgramUniform1uiv(program, glGetUniformLocation(program, "marker_sprites"), 3, markers);
+    
+    // A path into a known room without a door back keeps an empty texture area
+    glm::uint paths[] {
+            sprite({ 16, 8 }, textures::visited_path_down), sprite({ 16, 8 }, textures::unvisited_path_down_transition),
+            sprite({ 16, 8 }, textures::unvisited_path_down), sprite({ 16, 8 }, textures::unvisited_path_down_end), sprite({ 16, 8 }, { }),
+            sprite({ 8, 16 }, textures::visited_path_right), sprite({ 8, 16 }, textures::unvisited_path_right_transition),
+            sprite({ 8, 16 }, textures::unvisited_path_right), sprite({ 8, 16 }, textures::unvisited_path_right_end), sprite({ 8, 16 }, { })
+    };
+    glProgramUniform1uiv(program, glGetUniformLocation(program, "path_sprites"), 10, paths);
+    glProgramUniform1ui(program, glGetUniformLocation(program, "empty_sprite"), sprite({ 0, 0 }, { }));
+    
+    program = global_state.opengl.shader.cull_program;
+    glProgramUniform1ui(program, glGetUniformLocation(program, "empty_sprite"), sprite({ 0, 0 }, { }));
+}
+void
+update_map_layer( ) {
+    auto& layer = global_state.map.layer;
+    if(layer.dirty.empty( )) return;
+    
+    // Only new rooms upload anything here, their position, the state bytes are already in the room state texture
+    auto first = (unsigned) layer.slots.size( );
+    auto last = 0u;
+    auto room_count = (unsigned) layer.slots.size( );
+    for(point_id_t point: layer.dirty) {
+        auto room = global_state.map.rooms.find(point);
+        if(room == std::end(global_state.map.rooms)) continue;
+        
+        auto [slot, inserted] = layer.slots.try_emplace(point, (unsigned) layer.slots.size( ));
+        if(inserted) layer.positions.push_back(room->second.position);
+        first = std::min(first, slot->second);
+        last = std::max(last, slot->second + 1);
+    }
+    layer.dirty.clear( );
+    if(first >= last) return;
+    
+    if(layer.capacity < layer.slots.size( )) {
+        layer.capacity = std::max((unsigned) layer.slots.size( ), layer.capacity * 2);
+        bind_buffer(GL_ARRAY_BUFFER, global_state.opengl.shader.buffers.map_instances_id);
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr) (sizeof(rect_instance) * constants::map::room_slots * layer.capacity), nullptr, GL_DYNAMIC_DRAW);
+        bind_buffer(GL_ARRAY_BUFFER, global_state.opengl.shader.buffers.room_positions_id);
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr) (sizeof(glm::ivec2) * layer.capacity), nullptr, GL_DYNAMIC_DRAW);
+        
+        // Every slot is expanded again into the new storage
+        room_count = 0;
+        first = 0;
+        last = (unsigned) layer.slots.size( );
+    }
+    if(room_count < layer.positions.size( )) {
+        bind_buffer(GL_ARRAY_BUFFER, global_state.opengl.shader.buffers.room_positions_id);
+        glBufferSubData(GL_ARRAY_BUFFER, (GLintptr) (sizeof(glm::ivec2) * room_count), (GLsizeiptr) (sizeof(glm::ivec2) * (layer.positions.size( ) - room_count)),
+                &layer.positions[room_count]);
+    }
+    
+    GLuint program = global_state.opengl.shader.expand_program;
+    use_program(program);
+    glProgramUniform1ui(program, glGetUniformLocation(program, "first_room"), first);
+    glProgramUniform1ui(program, glGetUniformLocation(program, "room_count"), last - first);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, global_state.opengl.shader.buffers.room_positions_id);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, global_state.opengl.shader.buffers.map_instances_id);
+    glDispatchCompute((last - first + 63) / 64, 1, 1);
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
+    use_program(global_state.opengl.shader.program);
+}
+void
+render_map_tiles( ) {
+    // The tile pass uses its own program so the draws recorded so far go first
+    submit_draws( );
+    use_program(global_state.opengl.shader.tile_program);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    use_program(global_state.opengl.shader.program);
+    global_state.opengl.frame.draws++;
+    global_state.opengl.frame.draw_calls++;
+    global_state.opengl.frame.state_changes += 2;
+}
+void
+render_map_instances( ) {
+    // The retained rooms are tested against the view on the GPU, the slots of those in view are compacted into the frame's stream
+    // and counted straight into the instance count of the map's draw command, room by room so markers stay above their room
+    auto& ring = global_state.opengl.ring;
+    auto rooms = (unsigned) global_state.map.layer.slots.size( );
+    unsigned first = reserve_instances(rooms * constants::map::room_slots);
+    unsigned command = ring.command_head;
+    record_draw(first, 0, constants::opengl::instance::translated | constants::opengl::instance::border_fade);
+    
+    GLuint program = global_state.opengl.shader.cull_program;
+    use_program(program);
+    glProgramUniform1ui(program, glGetUniformLocation(program, "room_count"), rooms);
+    glProgramUniform1ui(program, glGetUniformLocation(program, "first_visible"), first);
+    glProgramUniform1ui(program, glGetUniformLocation(program, "instance_count_index"),
+            (unsigned) ((sizeof(draw_command) * (ring.region * constants::opengl::ring::region_commands + command) + offsetof(draw_command, instance_count)) / sizeof(GLuint)));
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, global_state.opengl.shader.buffers.room_positions_id);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, global_state.opengl.shader.buffers.map_instances_id);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, global_state.opengl.shader.buffers.quad_instanced_pos_id);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, global_state.opengl.shader.buffers.draw_commands_id);
+    flush_uniforms( );
+    glDispatchCompute((rooms + 63) / 64, 1, 1);
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT);
+    use_program(global_state.opengl.shader.program);
+    global_state.opengl.frame.state_changes += 6;
+    
+    global_state.opengl.cull.commands[ring.region] = (int) command;
+    global_state.opengl.cull.submitted[ring.region] = rooms;
+}
+bool
+render_map_cache( ) {
+    auto& cache = global_state.map.cache;
+    if(!cache.stale) return true;
+    
+    // Every room with its stubs and a margin, the texture only grows so its sprite rarely changes
+    glm::ivec2 low { constants::map::radius<int> }, high { -constants::map::radius<int> };
+    for(const auto& position: global_state.map.layer.positions) {
+        low = glm::min(low, position);
+        high = glm::max(high, position);
+    }
+    int border = constants::map::room_extent + constants::map::cache_margin;
+    glm::ivec2 origin = low * (int) constants::map::room_area - border;
+    glm::uvec2 extent = (glm::uvec2) ((high - low) * (int) constants::map::room_area + border * 2);
+    
+    glm::uvec2 size = glm::max(cache.size, glm::uvec2(constants::map::cache_min_size));
+    while(size.x < extent.x) size.x *= 2;
+    while(size.y < extent.y) size.y *= 2;
+    GLint max_size = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_size);
+    if(size.x > (unsigned) max_size || size.y > (unsigned) max_size) return false;
+    
+    if(size != cache.size) {
+        bind_texture(3, GL_TEXTURE_2D, global_state.opengl.textures.map_cache_id);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, (GLsizei) size.x, (GLsizei) size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        bind_framebuffer(GL_FRAMEBUFFER, global_state.opengl.framebuffers.map_cache_id);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, global_state.opengl.textures.map_cache_id, 0);
+        if(glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) throw std::runtime_error("Map cache framebuffer is incomplete");
+        cache.size = size;
+    }
+    cache.origin = origin;
+    cache.stale = false;
+    
+    // Draws recorded so far go to the frame, the map is then drawn alone with the cache as the screen and its origin at the top left
+    submit_draws( );
+    if(global_state.opengl.damage.partial) glDisable(GL_SCISSOR_TEST);
+    bind_framebuffer(GL_FRAMEBUFFER, global_state.opengl.framebuffers.map_cache_id);
+    glViewport(0, 0, (GLsizei) size.x, (GLsizei) size.y);
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    
+    auto& state = global_state.opengl.state;
+    screen_info screen = state.screen;
+    translation_info translation = state.translation;
+    state.screen = { size };
+    state.translation = { (glm::vec2) -origin, (glm::vec2) -origin, 1, 1, 0, 0 };
+    
+    render_map_instances( );
+    submit_draws( );
+    
+    bind_framebuffer(GL_FRAMEBUFFER, global_state.opengl.framebuffers.frame_id);
+    glViewport(0, 0, (GLsizei) global_state.window.size.x, (GLsizei) global_state.window.size.y);
+    state.screen = screen;
+    state.translation = translation;
+    if(global_state.opengl.damage.partial) glEnable(GL_SCISSOR_TEST);
+    global_state.opengl.frame.state_changes += 10;
+    return true;
+}
+void
+render_map_overview( ) {
+    // Covers every grid cell, each cell spans half the room area around its grid point
+    int half = (int) constants::map::room_area / 2;
+    glm::ivec2 position = glm::ivec2(-constants::map::radius<int> * (int) constants::map::room_area - half);
+    glm::uvec2 size = glm::uvec2(constants::map::size * constants::map::room_area);
+    
+    update_overview_mips( );
+    unsigned flags = global_state.opengl.frame.flags;
+    global_state.opengl.frame.flags = flags | constants::opengl::instance::translated | constants::opengl::instance::map_overview;
+    bind_layer(texture_layer::texture);
+    draw_rect(rect { { position, size }, textures::all, uv_translation::rot_0 });
+    global_state.opengl.frame.flags = flags;
+}
+void
+update_minimap( ) {
+    auto& minimap = global_state.map.minimap;
+    if(!minimap.stale) return;
+    minimap.stale = false;
+    
+    // A square of whole cells around the explored rooms, as texture coordinates of the overview
+    glm::ivec2 extent = minimap.high - minimap.low + 1;
+    int cells = std::max({ extent.x, extent.y, constants::map::minimap_min_cells });
+    glm::vec2 low = (glm::vec2) (minimap.low + constants::map::radius<int>) - (glm::vec2) (glm::ivec2(cells) - extent) * 0.5f;
+    auto size = (float) constants::map::size;
+    global_state.opengl.shader.minimap_area = { low.x / size, low.y / size, (float) cells / size, (float) cells / size };
+    for(auto [flags, program]: global_state.opengl.shader.variants) update_variant_uniforms(program);
+}
+void
+render_minimap( ) {
+    if(global_state.map.minimap.empty) return;
+    update_minimap( );
+    update_overview_mips( );
+    
+    // The same overview as far zoom, one quad however large the map is
+    unsigned flags = global_state.opengl.frame.flags;
+    global_state.opengl.frame.flags = flags | constants::opengl::instance::map_overview | constants::opengl::instance::minimap;
+    enable_translation(false);
+    bind_layer(texture_layer::texture);
+    draw_rect(rect { { minimap_position( ), glm::uvec2(constants::map::minimap_size) }, textures::all, uv_translation::rot_0 });
+    global_state.opengl.frame.flags = flags;
+}
+void
+render_map( ) {
+    update_room_states( );
+    if(global_state.map.tile_renderer) {
+        render_map_tiles( );
+        return;
+    }
+    
+    update_map_layer( );
+    if(global_state.map.layer.slots.empty( )) return;
+    
+    // Rooms only a few pixels wide are drawn from the overview, one quad whatever the number of rooms
+    if(global_state.map.camera.scale < constants::map::overview_scale) {
+        render_map_overview( );
+        return;
+    }
+    
+    // Too large a map is culled and drawn every frame instead
+    if(!render_map_cache( )) {
+        render_map_instances( );
+        return;
+    }
+    
+    // The cache is drawn the right way up with its bottom row at the end of the texture, in map space and faded like the rooms it holds
+    auto& cache = global_state.map.cache;
+    unsigned flags = global_state.opengl.frame.flags;
+    global_state.opengl.frame.flags = flags | constants::opengl::instance::translated | constants::opengl::instance::map_cache;
+    bind_layer(texture_layer::texture);
+    draw_rect(rect { { cache.origin, cache.size }, textures::all, uv_translation::flip_vert });
+    global_state.opengl.frame.flags = flags;
 }
 void
 render_player_dot( ) {
-    // Player dot
+    // Player dots, the active player is drawn last and full size
+    std::vector<rect> dots;
+    for(unsigned i = 0; i < global_state.map.players.size( ); i++) {
+        if(i == global_state.map.active_player) continue;
+        dots.push_back(rect { { global_state.map.players[i].position * 40 - glm::ivec2(5), { 10, 10 } }, textures::player_dot, uv_translation::rot_0 });
+    }
+    dots.push_back(rect { { active_player( ).position * 40 - glm::ivec2(8), { 16, 16 } }, textures::player_dot, uv_translation::rot_0 });
+    
     enable_translation(true);
-    bind_texture(global_state.opengl.textures.texture_id);
-    draw_rect(rect { { (global_state.map.position * 40 - glm::ivec2(8)) * (int) global_state.global_scale,
-            glm::uvec2(16, 16) * global_state.global_scale }, textures::player_dot, uv_translation::rot_0 });
+    bind_layer(texture_layer::texture);
+    draw_rect(dots);
 }
 void
 render_portal( ) {
-    // Portal
+    // Portal, in map space so the view scale already holds the global scale
     enable_translation(true);
-    bind_texture(global_state.opengl.textures.texture_id);
-    draw_rect(rect { { glm::ivec2(-3, -4) * (int) global_state.global_scale, glm::uvec2(16, 16) * global_state.global_scale }, textures::portal, uv_translation::rot_0 });
+    bind_layer(texture_layer::texture);
+    draw_rect(rect { { { -3, -4 }, { 16, 16 } }, textures::portal, uv_translation::rot_0 });
 }
 void
 render_map_compass( ) {
     // Compass
     enable_translation(false);
-    bind_texture(global_state.opengl.textures.compass_id);
+    bind_layer(texture_layer::compass);
     draw_rect(rect { { glm::uvec2(global_state.window.size.x - 128 - 8, 8), { 128, 128 } }, textures::all, uv_translation::rot_0 });
 }
 void
@@ -1402,11 +3762,12 @@ render_last_path( ) {
     rect hori { { constants::zero<int>, { 14, 2 } }, textures::red, uv_translation::rot_0 };
     rect vert { { constants::zero<int>, { 2, 14 } }, textures::red, uv_translation::rot_0 };
     
-    for(unsigned i = 0; i < global_state.map.path_size; i++) {
-        unsigned index = i + global_state.map.path_head;
+    for(const auto& player: global_state.map.players)
+    for(unsigned i = 0; i < player.path_size; i++) {
+        unsigned index = i + player.path_head;
         if(index >= constants::map::path_count) index -= constants::map::path_count;
         
-        auto [point, dir] = global_state.map.path[index];
+        auto [point, dir] = player.path[index];
         glm::ivec2 pos = point *= 40;
         
         if(dir == path_flag::north) {
@@ -1432,19 +3793,16 @@ render_last_path( ) {
     }
     
     enable_translation(true);
-    bind_texture(global_state.opengl.textures.texture_id);
+    bind_layer(texture_layer::texture);
     draw_rect(paths);
 }
 void
-render_portal_path( ) {
-    if(global_state.map.portal_path.empty( )) return;
+build_route(std::vector<rect>& paths, const glm::ivec2& origin, const std::vector<glm::ivec2>& route, const uv_quad& texture) {
+    rect hori { { constants::zero<int>, { 40, 2 } }, texture, uv_translation::rot_0 };
+    rect vert { { constants::zero<int>, { 2, 40 } }, texture, uv_translation::rot_0 };
     
-    std::vector<rect> paths;
-    rect hori { { constants::zero<int>, { 40, 2 } }, textures::yellow, uv_translation::rot_0 };
-    rect vert { { constants::zero<int>, { 2, 40 } }, textures::yellow, uv_translation::rot_0 };
-    
-    glm::ivec2 point = constants::zero<int>;
-    for(const auto& dir: global_state.map.portal_path) {
+    glm::ivec2 point = origin;
+    for(const auto& dir: route) {
         glm::ivec2 pos = point * 40;
         
         if(dir == constants::north<int>) {
@@ -1470,53 +3828,165 @@ render_portal_path( ) {
         
         point += dir;
     }
+}
+void
+render_portal_path( ) {
+    std::vector<rect> paths;
+    for(const auto& player: global_state.map.players)
+        build_route(paths, constants::zero<int>, player.portal_path, textures::yellow);
+    if(paths.empty( )) return;
+    
+    enable_translation(true);
+    bind_layer(texture_layer::texture);
+    draw_rect(paths);
+}
+void
+render_target_path( ) {
+    if(!global_state.map.has_route_target) return;
+    std::vector<rect> paths;
+    build_route(paths, global_state.map.route_target, global_state.map.target_path, textures::green);
     
     enable_translation(true);
-    bind_texture(global_state.opengl.textures.texture_id);
+    bind_layer(texture_layer::texture);
     draw_rect(paths);
 }
 void
+begin_damage( ) {
+    auto& damage = global_state.opengl.damage;
+    glm::ivec2 size = (glm::ivec2) global_state.window.size;
+    glm::ivec2 low = glm::clamp(damage.low, glm::ivec2(0), size);
+    glm::ivec2 extent = glm::clamp(damage.high, glm::ivec2(0), size) - low;
+    
+    // Anything that asked for a redraw gets a full one, as does a damaged area too large to be worth clipping
+    damage.partial = damage.valid && !global_state.redraw && damage.pending && extent.x * extent.y * 2 < size.x * size.y && !global_state.profiler.enabled &&
+            !global_state.opengl.overdraw.enabled;
+    damage.pending = false;
+    damage.valid = true;
+    
+    bind_framebuffer(GL_FRAMEBUFFER, global_state.opengl.framebuffers.frame_id);
+    if(!damage.partial) return;
+    
+    // The frame is drawn as usual, only the damaged area of the kept frame is touched
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(low.x, size.y - low.y - extent.y, extent.x, extent.y);
+#if RENDER_STATISTICS
+    std::cout << "Damage: " << extent.x * extent.y << " of " << size.x * size.y << " pixels" << std::endl;
+#endif
+}
+void
+begin_overdraw( ) {
+    auto& overdraw = global_state.opengl.overdraw;
+    auto& ring = global_state.opengl.ring;
+    
+    // The region's fence was waited on, the count of the frame that last used it is done and read without a stall
+    if(overdraw.counted[ring.region]) {
+        overdraw.counted[ring.region] = false;
+        // The fence does not make shader atomics visible to buffer reads, only a barrier does
+        glMemoryBarrier(GL_ATOMIC_COUNTER_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+        bind_buffer(GL_ATOMIC_COUNTER_BUFFER, global_state.opengl.shader.buffers.overdraw_counter_id);
+        glGetBufferSubData(GL_ATOMIC_COUNTER_BUFFER, (GLintptr) (sizeof(GLuint) * ring.region), sizeof(GLuint), &overdraw.fragments);
+        
+        auto pixels = (double) global_state.window.size.x * global_state.window.size.y;
+        char title[96];
+        std::snprintf(title, sizeof(title), "Vault Mapper - %u fragments, %.2f per pixel", overdraw.fragments, overdraw.fragments / pixels);
+        glfwSetWindowTitle(global_state.window.handle, title);
+    }
+    if(!overdraw.enabled) return;
+    
+    GLuint zero = 0;
+    glClearTexImage(global_state.opengl.textures.overdraw_id, 0, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+    bind_buffer(GL_ATOMIC_COUNTER_BUFFER, global_state.opengl.shader.buffers.overdraw_counter_id);
+    glClearBufferSubData(GL_ATOMIC_COUNTER_BUFFER, GL_R32UI, (GLintptr) (sizeof(GLuint) * ring.region), sizeof(GLuint), GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+    glBindBufferRange(GL_ATOMIC_COUNTER_BUFFER, 0, global_state.opengl.shader.buffers.overdraw_counter_id, (GLintptr) (sizeof(GLuint) * ring.region), sizeof(GLuint));
+    overdraw.counted[ring.region] = true;
+}
+void
+render_overdraw( ) {
+    if(!global_state.opengl.overdraw.enabled) return;
+    
+    // Every fragment of the frame has been counted, the heatmap replaces the frame
+    glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+    glDisable(GL_BLEND);
+    use_program(global_state.opengl.shader.heatmap_program);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glEnable(GL_BLEND);
+    global_state.opengl.frame.draw_calls++;
+    global_state.opengl.frame.state_changes += 3;
+}
+void
+present_frame( ) {
+    if(global_state.opengl.damage.partial) glDisable(GL_SCISSOR_TEST);
+    
+    // The back buffer is undefined after a swap so the kept frame is always copied whole
+    auto size = (glm::ivec2) global_state.window.size;
+    bind_framebuffer(GL_READ_FRAMEBUFFER, global_state.opengl.framebuffers.frame_id);
+    bind_framebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    glBlitFramebuffer(0, 0, size.x, size.y, 0, 0, size.x, size.y, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+}
+void
 render( ) {
+    auto begin = profile_clock( );
+    // The clock goes with the translation, one buffer write a frame for every program
+    global_state.opengl.state.translation.time = (float) glfwGetTime( );
+    begin_instance_frame( );
+    profile_begin_frame( );
+    begin_damage( );
+    begin_overdraw( );
+    profile_stage(profile_timer::background);
     glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT);
-    glActiveTexture(GL_TEXTURE0);
     render_background( );
     
     if(!global_state.map.pick_direction) {
-        glProgramUniform1i(global_state.opengl.shader.program, global_state.opengl.shader.uniforms.border_fade_id, 1);
+        enable_border_fade(true);
+        profile_stage(profile_timer::map);
+        auto map_begin = profile_clock( );
         render_map( );
+        profile_cpu(profile_timer::map_instances, map_begin);
+        profile_stage(profile_timer::paths);
         render_last_path( );
         render_portal_path( );
+        render_target_path( );
+        profile_stage(profile_timer::markers);
         render_portal( );
         render_player_dot( );
-        glProgramUniform1i(global_state.opengl.shader.program, global_state.opengl.shader.uniforms.border_fade_id, 0);
+        enable_border_fade(false);
+        profile_stage(profile_timer::overlays);
         render_map_compass( );
+        render_minimap( );
     } else {
         // Compass
+        profile_stage(profile_timer::overlays);
         enable_translation(false);
-        bind_texture(global_state.opengl.textures.compass_id);
+        bind_layer(texture_layer::compass);
         draw_rect(rect { { { (global_state.window.size.x - 256) >> 1, (global_state.window.size.y - 256) >> 1 }, { 256, 256 } }, textures::all, uv_translation::rot_0 });
     }
     
     if(global_state.show_help) {
         // Help
         enable_translation(false);
-        bind_texture(global_state.opengl.textures.help_id);
-        draw_rect(rect { { constants::zero<int>, global_state.window.size }, textures::all, uv_translation::rot_0 });
+        bind_layer(texture_layer::help);
+        draw_rect(screen_rect(textures::all));
     } else {
         // Help F1
         enable_translation(false);
-        bind_texture(global_state.opengl.textures.texture_id);
+        bind_layer(texture_layer::texture);
         draw_rect(rect { { { 12, 12 }, { 32, 32 } }, textures::help_text, uv_translation::rot_0 });
     }
     
     if(global_state.enable_global_keys) {
         // Global keys dot
         enable_translation(false);
-        bind_texture(global_state.opengl.textures.texture_id);
-        draw_rect(rect { { { 8, global_state.window.size.y - 16 - 8 }, glm::uvec2(16, 16) * global_state.global_scale }, textures::player_dot, uv_translation::rot_0 });
+        bind_layer(texture_layer::texture);
+        draw_rect(rect { { global_keys_dot_position( ), global_keys_dot_size( ) }, textures::player_dot, uv_translation::rot_0 });
     }
     
     render_map_scale( );
-    
+    render_profiler( );
+    end_instance_frame( );
+    render_overdraw( );
+    profile_stage(profile_timer::present);
+    present_frame( );
+    profile_cpu(profile_timer::render, begin);
+    profile_end_frame( );
 }
@@ -0,0 +1,75 @@
+#version 440
+
+layout(local_size_x = 64) in;
+
+layout(binding = 0, std140) uniform screen_info {
+    uvec2 size;
+} screen;
+
+// A view move, evaluated for the current time so the whole move is one write
+layout(binding = 1, std140) uniform translation_info {
+    vec2 start;
+    vec2 target;
+    float start_scale;
+    float target_scale;
+    float start_time;
+    float duration;
+    // Seconds on the same clock as the start time, written with the frame
+    float time;
+} translation;
+
+layout(std430, binding = 0) readonly buffer room_positions {
+    ivec2 positions[];
+};
+// Packed 'rect_instance' slots, 'room_slots' per room
+layout(std430, binding = 1) readonly buffer map_instances {
+    uvec2 instances[];
+};
+// The frame's instance stream and draw commands
+layout(std430, binding = 3) writeonly buffer visible_instances {
+    uvec2 visible[];
+};
+layout(std430, binding = 4) buffer draw_commands {
+    uint commands[];
+};
+
+uniform uint room_count;
+// Where the visible instances go in the stream and the 'instance_count' of their draw command
+uniform uint first_visible;
+uniform uint instance_count_index;
+uniform uint empty_sprite;
+
+const uint room_slots = 6u;
+// Rooms with their door stubs stay within this distance of their grid point
+const int room_extent = 24;
+
+// Eased out like 'update' on the CPU
+float
+view_progress() {
+    float t = translation.duration > 0.0 ? clamp((translation.time - translation.start_time) / translation.duration, 0.0, 1.0) : 1.0;
+    return 1.0 - pow(1.0 - t, 3.0);
+}
+
+void main() {
+    if (gl_GlobalInvocationID.x >= room_count) return;
+    uint room = gl_GlobalInvocationID.x;
+
+    // Same translation as the rect vertex shader, in normalized device coordinates
+    vec2 pixel = vec2(2.0 / float(screen.size.x), -2.0 / float(screen.size.y));
+    float progress = view_progress();
+    vec2 view = mix(translation.start, translation.target, progress);
+    float scale = mix(translation.start_scale, translation.target_scale, progress);
+    vec2 low = ((vec2(positions[room] * 40 - room_extent) + view) * pixel + vec2(-1, 1)) * scale;
+    vec2 high = ((vec2(positions[room] * 40 + room_extent) + view) * pixel + vec2(-1, 1)) * scale;
+    if (high.x <= -1.0 || low.x >= 1.0 || low.y <= -1.0 || high.y >= 1.0) return;
+
+    // A room keeps its slots together and in order so its marker stays above it
+    uvec2 slots[room_slots];
+    uint count = 0u;
+    for (uint i = 0u; i < room_slots; i++) {
+        uvec2 instance = instances[room * room_slots + i];
+        if ((instance.y & 0xFFFFu) != empty_sprite) slots[count++] = instance;
+    }
+    uint first = atomicAdd(commands[instance_count_index], count);
+    for (uint i = 0u; i < count; i++) visible[first_visible + first + i] = slots[i];
+}
\ No newline at end of file
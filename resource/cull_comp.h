@@ -0,0 +1,82 @@
+#ifndef _CULL_COMP_H
+#define _CULL_COMP_H
+
+inline constexpr char cull_comp[] {
+        "#version 440\n"
+        "\n"
+        "layout(local_size_x = 64) in;\n"
+        "\n"
+        "layout(binding = 0, std140) uniform screen_info {\n"
+        "    uvec2 size;\n"
+        "} screen;\n"
+        "\n"
+        "// A view move, evaluated for the current time so the whole move is one write\n"
+        "layout(binding = 1, std140) uniform translation_info {\n"
+        "    vec2 start;\n"
+        "    vec2 target;\n"
+        "    float start_scale;\n"
+        "    float target_scale;\n"
+        "    float start_time;\n"
+        "    float duration;\n"
+        "    // Seconds on the same clock as the start time, written with the frame\n"
+        "    float time;\n"
+        "} translation;\n"
+        "\n"
+        "layout(std430, binding = 0) readonly buffer room_positions {\n"
+        "    ivec2 positions[];\n"
+        "};\n"
+        "// Packed 'rect_instance' slots, 'room_slots' per room\n"
+        "layout(std430, binding = 1) readonly buffer map_instances {\n"
+        "    uvec2 instances[];\n"
+        "};\n"
+        "// The frame's instance stream and draw commands\n"
+        "layout(std430, binding = 3) writeonly buffer visible_instances {\n"
+        "    uvec2 visible[];\n"
+        "};\n"
+        "layout(std430, binding = 4) buffer draw_commands {\n"
+        "    uint commands[];\n"
+        "};\n"
+        "\n"
+        "uniform uint room_count;\n"
+        "// Where the visible instances go in the stream and the 'instance_count' of their draw command\n"
+        "uniform uint first_visible;\n"
+        "uniform uint instance_count_index;\n"
+        "uniform uint empty_sprite;\n"
+        "\n"
+        "const uint room_slots = 6u;\n"
+        "// Rooms with their door stubs stay within this distance of their grid point\n"
+        "const int room_extent = 24;\n"
+        "\n"
+        "// Eased out like 'update' on the CPU\n"
+        "float\n"
+        "view_progress() {\n"
+        "    float t = translation.duration > 0.0 ? clamp((translation.time - translation.start_time) / translation.duration, 0.0, 1.0) : 1.0;\n"
+        "    return 1.0 - pow(1.0 - t, 3.0);\n"
+        "}\n"
+        "\n"
+        "void main() {\n"
+        "    if (gl_GlobalInvocationID.x >= room_count) return;\n"
+        "    uint room = gl_GlobalInvocationID.x;\n"
+        "\n"
+        "    // Same translation as the rect vertex shader, in normalized device coordinates\n"
+        "    vec2 pixel = vec2(2.0 / float(screen.size.x), -2.0 / float(screen.size.y));\n"
+        "    float progress = view_progress();\n"
+        "    vec2 view = mix(translation.start, translation.target, progress);\n"
+        "    float scale = mix(translation.start_scale, translation.target_scale, progress);\n"
+        "    vec2 low = ((vec2(positions[room] * 40 - room_extent) + view) * pixel + vec2(-1, 1)) * scale;\n"
+        "    vec2 high = ((vec2(positions[room] * 40 + room_extent) + view) * pixel + vec2(-1, 1)) * scale;\n"
+        "    if (high.x <= -1.0 || low.x >= 1.0 || low.y <= -1.0 || high.y >= 1.0) return;\n"
+        "\n"
+        "    // A room keeps its slots together and in order so its marker stays above it\n"
+        "    uvec2 slots[room_slots];\n"
+        "    uint count = 0u;\n"
+        "    for (uint i = 0u; i < room_slots; i++) {\n"
+        "        uvec2 instance = instances[room * room_slots + i];\n"
+        "        if ((instance.y & 0xFFFFu) != empty_sprite) slots[count++] = instance;\n"
+        "    }\n"
+        "    uint first = atomicAdd(commands[instance_count_index], count);\n"
+        "    for (uint i = 0u; i < count; i++) visible[first_visible + first + i] = slots[i];\n"
+        "}"
+};
+
+#endif //_CULL_COMP_H
@@ -0,0 +1,90 @@
+#version 440
+
+layout(local_size_x = 64) in;
+
+// One byte per grid cell, see 'room_state'
+layout(binding = 2) uniform usampler2D room_state;
+
+layout(std430, binding = 0) readonly buffer room_positions {
+    ivec2 positions[];
+};
+// Packed 'rect_instance' slots, 'room_slots' per room
+layout(std430, binding = 1) writeonly buffer map_instances {
+    uvec2 instances[];
+};
+
+// Range of rooms to expand
+uniform uint first_room;
+uniform uint room_count;
+
+// Sprite table entries, room sprites indexed by paths and visited like 'textures::mapped_rooms'
+uniform uint room_sprites[32];
+uniform uint room_transforms[32];
+uniform uint marker_sprites[3];
+// Visited, transition, unvisited, end and doorless path sprites, down then right
+uniform uint path_sprites[10];
+uniform uint empty_sprite;
+
+const int map_radius = 200;
+const uint room_slots = 6u;
+
+const uint state_visited = 0x10u;
+const uint state_known = 0x80u;
+
+const uint rot_0 = 0u;
+const uint flip_vert = 4u;
+const uint flip_hori = 5u;
+
+uint
+state(ivec2 cell) {
+    cell += map_radius;
+    if (any(lessThan(cell, ivec2(0))) || any(greaterThan(cell, ivec2(map_radius * 2)))) return 0u;
+    return texelFetch(room_state, cell, 0).r;
+}
+
+uvec2
+pack_instance(ivec2 position, uint sprite, uint transform) {
+    return uvec2((uint(position.x) & 0xFFFFu) | (uint(position.y) << 16), sprite | (transform << 16));
+}
+
+uvec2
+path_instance(ivec2 position, uint from, uint to, uint to_door, int sprites, uint flip) {
+    if ((to & state_known) == 0u) return pack_instance(position, path_sprites[sprites + 3], rot_0);
+    if ((to & to_door) == 0u) return pack_instance(position, path_sprites[sprites + 4], rot_0);
+
+    bool visited = (from & to & state_visited) != 0u;
+    bool other = (to & state_visited) != 0u;
+    bool one_visited = ((from | to) & state_visited) != 0u;
+    int sprite = visited ? 0 : one_visited ? 1 : 2;
+    return pack_instance(position, path_sprites[sprites + sprite], one_visited && other ? flip : rot_0);
+}
+
+void main() {
+    if (gl_GlobalInvocationID.x >= room_count) return;
+    uint room = first_room + gl_GlobalInvocationID.x;
+    ivec2 cell = positions[room];
+    uint here = state(cell);
+
+    uvec2 slots[room_slots];
+    for (uint i = 0u; i < room_slots; i++) slots[i] = pack_instance(ivec2(0), empty_sprite, rot_0);
+    uint slot = 0u;
+
+    // Same order as the rooms were built on the CPU, the room then its marker, the south and east paths and the north and west ends
+    ivec2 position = cell * 40 - 16;
+    uint index = here & 0x1Fu;
+    slots[slot++] = pack_instance(position, room_sprites[index], room_transforms[index]);
+
+    uint marker = (here >> 5) & 0x3u;
+    if (marker != 0u) slots[slot++] = pack_instance(position, marker_sprites[marker - 1u], room_transforms[index]);
+
+    if ((here & 0x1u) != 0u)
+        slots[slot++] = path_instance(position + ivec2(10, 32), here, state(cell + ivec2(0, 1)), 0x4u, 0, flip_vert);
+    if ((here & 0x2u) != 0u)
+        slots[slot++] = path_instance(position + ivec2(32, 10), here, state(cell + ivec2(1, 0)), 0x8u, 5, flip_hori);
+    if ((here & 0x4u) != 0u && (state(cell + ivec2(0, -1)) & state_known) == 0u)
+        slots[slot++] = pack_instance(position + ivec2(10, -8), path_sprites[3], flip_vert);
+    if ((here & 0x8u) != 0u && (state(cell + ivec2(-1, 0)) & state_known) == 0u)
+        slots[slot++] = pack_instance(position + ivec2(-8, 10), path_sprites[8], flip_hori);
+
+    for (uint i = 0u; i < room_slots; i++) instances[room * room_slots + i] = slots[i];
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#ifndef _EXPAND_COMP_H
+#define _EXPAND_COMP_H
+
+inline constexpr char expand_comp[] {
+        "#version 440\n"
+        "\n"
+        "layout(local_size_x = 64) in;\n"
+        "\n"
+        "// One byte per grid cell, see 'room_state'\n"
+        "layout(binding = 2) uniform usampler2D room_state;\n"
+        "\n"
+        "layout(std430, binding = 0) readonly buffer room_positions {\n"
+        "    ivec2 positions[];\n"
+        "};\n"
+        "// Packed 'rect_instance' slots, 'room_slots' per room\n"
+        "layout(std430, binding = 1) writeonly buffer map_instances {\n"
+        "    uvec2 instances[];\n"
+        "};\n"
+        "\n"
+        "// Range of rooms to expand\n"
+        "uniform uint first_room;\n"
+        "uniform uint room_count;\n"
+        "\n"
+        "// Sprite table entries, room sprites indexed by paths and visited like 'textures::mapped_rooms'\n"
+        "uniform uint room_sprites[32];\n"
+        "uniform uint room_transforms[32];\n"
+        "uniform uint marker_sprites[3];\n"
+        "// Visited, transition, unvisited, end and doorless path sprites, down then right\n"
+        "uniform uint path_sprites[10];\n"
+        "uniform uint empty_sprite;\n"
+        "\n"
+        "const int map_radius = 200;\n"
+        "const uint room_slots = 6u;\n"
+        "\n"
+        "const uint state_visited = 0x10u;\n"
+        "const uint state_known = 0x80u;\n"
+        "\n"
+        "const uint rot_0 = 0u;\n"
+        "const uint flip_vert = 4u;\n"
+        "const uint flip_hori = 5u;\n"
+        "\n"
+        "uint\n"
+        "state(ivec2 cell) {\n"
+        "    cell += map_radius;\n"
+        "    if (any(lessThan(cell, ivec2(0))) || any(greaterThan(cell, ivec2(map_radius * 2)))) return 0u;\n"
+        "    return texelFetch(room_state, cell, 0).r;\n"
+        "}\n"
+        "\n"
+        "uvec2\n"
+        "pack_instance(ivec2 position, uint sprite, uint transform) {\n"
+        "    return uvec2((uint(position.x) & 0xFFFFu) | (uint(position.y) << 16), sprite | (transform << 16));\n"
+        "}\n"
+        "\n"
+        "uvec2\n"
+        "path_instance(ivec2 position, uint from, uint to, uint to_door, int sprites, uint flip) {\n"
+        "    if ((to & state_known) == 0u) return pack_instance(position, path_sprites[sprites + 3], rot_0);\n"
+        "    if ((to & to_door) == 0u) return pack_instance(position, path_sprites[sprites + 4], rot_0);\n"
+        "\n"
+        "    bool visited = (from & to & state_visited) != 0u;\n"
+        "    bool other = (to & state_visited) != 0u;\n"
+        "    bool one_visited = ((from | to) & state_visited) != 0u;\n"
+        "    int sprite = visited ? 0 : one_visited ? 1 : 2;\n"
+        "    return pack_instance(position, path_sprites[sprites + sprite], one_visited && other ? flip : rot_0);\n"
+        "}\n"
+        "\n"
+        "void main() {\n"
+        "    if (gl_GlobalInvocationID.x >= room_count) return;\n"
+        "    uint room = first_room + gl_GlobalInvocationID.x;\n"
+        "    ivec2 cell = positions[room];\n"
+        "    uint here = state(cell);\n"
+        "\n"
+        "    uvec2 slots[room_slots];\n"
+        "    for (uint i = 0u; i < room_slots; i++) slots[i] = pack_instance(ivec2(0), empty_sprite, rot_0);\n"
+        "    uint slot = 0u;\n"
+        "\n"
+        "    // Same order as the rooms were built on the CPU, the room then its marker, the south and east paths and the north and west ends\n"
+        "    ivec2 position = cell * 40 - 16;\n"
+        "    uint index = here & 0x1Fu;\n"
+        "    slots[slot++] = pack_instance(position, room_sprites[index], room_transforms[index]);\n"
+        "\n"
+        "    uint marker = (here >> 5) & 0x3u;\n"
+        "    if (marker != 0u) slots[slot++] = pack_instance(position, marker_sprites[marker - 1u], room_transforms[index]);\n"
+        "\n"
+        "    if ((here & 0x1u) != 0u)\n"
+        "        slots[slot++] = path_instance(position + ivec2(10, 32), here, state(cell + ivec2(0, 1)), 0x4u, 0, flip_vert);\n"
+        "    if ((here & 0x2u) != 0u)\n"
+        "        slots[slot++] = path_instance(position + ivec2(32, 10), here, state(cell + ivec2(1, 0)), 0x8u, 5, flip_hori);\n"
+        "    if ((here & 0x4u) != 0u && (state(cell + ivec2(0, -1)) & state_known) == 0u)\n"
+        "        slots[slot++] = pack_instance(position + ivec2(10, -8), path_sprites[3], flip_vert);\n"
+        "    if ((here & 0x8u) != 0u && (state(cell + ivec2(-1, 0)) & state_known) == 0u)\n"
+        "        slots[slot++] = pack_instance(position + ivec2(-8, 10), path_sprites[8], flip_hori);\n"
+        "\n"
+        "    for (uint i = 0u; i < room_slots; i++) instances[room * room_slots + i] = slots[i];\n"
+        "}"
+};
+
+#endif //_EXPAND_COMP_H
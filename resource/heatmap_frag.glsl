@@ -0,0 +1,17 @@
+#version 440
+
+// Fragments drawn to each pixel this frame, see 'render_overdraw'
+layout(binding = 0, r32ui) uniform readonly uimage2D overdraw;
+
+layout(location = 0) out vec4 out_color;
+
+// Cold to hot by the number of fragments, the last is eight and more
+const vec3 ramp[] = vec3[](
+vec3(0.0, 0.0, 0.0), vec3(0.0, 0.0, 0.6), vec3(0.0, 0.6, 0.2), vec3(0.6, 0.8, 0.0), vec3(1.0, 0.6, 0.0),
+vec3(1.0, 0.2, 0.0), vec3(0.8, 0.0, 0.4), vec3(0.8, 0.4, 1.0), vec3(1.0, 1.0, 1.0)
+);
+
+void main() {
+    uint count = imageLoad(overdraw, ivec2(gl_FragCoord.xy)).r;
+    out_color = vec4(ramp[min(count, 8u)], 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+#ifndef _HEATMAP_FRAG_H
+#define _HEATMAP_FRAG_H
+
+inline constexpr char heatmap_frag[] {
+        "#version 440\n"
+        "\n"
+        "// Fragments drawn to each pixel this frame, see 'render_overdraw'\n"
+        "layout(binding = 0, r32ui) uniform readonly uimage2D overdraw;\n"
+        "\n"
+        "layout(location = 0) out vec4 out_color;\n"
+        "\n"
+        "// Cold to hot by the number of fragments, the last is eight and more\n"
+        "const vec3 ramp[] = vec3[](\n"
+        "vec3(0.0, 0.0, 0.0), vec3(0.0, 0.0, 0.6), vec3(0.0, 0.6, 0.2), vec3(0.6, 0.8, 0.0), vec3(1.0, 0.6, 0.0),\n"
+        "vec3(1.0, 0.2, 0.0), vec3(0.8, 0.0, 0.4), vec3(0.8, 0.4, 1.0), vec3(1.0, 1.0, 1.0)\n"
+        ");\n"
+        "\n"
+        "void main() {\n"
+        "    uint count = imageLoad(overdraw, ivec2(gl_FragCoord.xy)).r;\n"
+        "    out_color = vec4(ramp[min(count, 8u)], 1.0);\n"
+        "}"
+};
+
+#endif //_HEATMAP_FRAG_H
@@ -3,338 +3,319 @@ inline constexpr unsigned char help[] {
     0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
     0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x2c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x79, 0x7d, 0x8e,
     0x75, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
-    0x14, 0xb4, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0xed, 0xdd, 0x41, 0x8e, 0xdd, 0x36, 0x12, 0x80,
-    0x61, 0xbd, 0x89, 0xb3, 0xcd, 0xac, 0xdd, 0x97, 0x68, 0xc0, 0x8b, 0x9c, 0x64, 0x6e, 0xe0, 0x55,
-    0x7c, 0x09, 0xbf, 0x53, 0x38, 0x2b, 0xdf, 0x20, 0x27, 0xc9, 0x22, 0x40, 0x5f, 0xa2, 0xbd, 0x4e,
-    0xb6, 0x81, 0xd1, 0x59, 0x18, 0x8c, 0x39, 0xec, 0x2a, 0xb2, 0x48, 0x51, 0x22, 0x8b, 0xfa, 0x3f,
-    0xc0, 0xe8, 0xb6, 0x9e, 0x44, 0x52, 0x94, 0x54, 0x4d, 0xf2, 0x49, 0xd4, 0x6d, 0xdb, 0xb6, 0x8f,
-    0x1b, 0x00, 0x38, 0xf0, 0x9f, 0xd1, 0x05, 0x00, 0x00, 0x2b, 0x02, 0x16, 0x00, 0x37, 0x08, 0x58,
-    0x00, 0xdc, 0x20, 0x60, 0x01, 0x70, 0xe3, 0xf4, 0x80, 0xf5, 0xf2, 0xf2, 0x72, 0x7f, 0x79, 0x79,
-    0xb9, 0x9f, 0x9d, 0xaf, 0xc5, 0xcc, 0x65, 0x03, 0xb0, 0x6d, 0x6f, 0xb4, 0x0f, 0xb4, 0x0b, 0xf7,
-    0x76, 0xbb, 0xdd, 0xe3, 0x75, 0xe2, 0xff, 0x5b, 0xd2, 0xb9, 0xdd, 0x6e, 0x87, 0x07, 0x85, 0x38,
-    0xfd, 0x34, 0xbf, 0x5c, 0x79, 0xcf, 0x28, 0x1b, 0x80, 0x76, 0x6a, 0x0b, 0x2b, 0x5c, 0xd8, 0xb7,
-    0xdb, 0xed, 0x1e, 0xfe, 0x85, 0xcf, 0xac, 0x2d, 0x91, 0x10, 0xd0, 0xd2, 0xed, 0x8f, 0x16, 0x97,
-    0x5d, 0xfa, 0x09, 0xc0, 0xa7, 0xaa, 0x2e, 0x61, 0x1a, 0xc4, 0x6a, 0x33, 0x4b, 0xb7, 0x91, 0x82,
-    0x5e, 0x08, 0x86, 0xf1, 0x67, 0xd2, 0xff, 0xb5, 0xcf, 0x6a, 0x48, 0x79, 0x49, 0x9f, 0xef, 0xcd,
-    0x07, 0x40, 0x1f, 0x6a, 0x97, 0x30, 0xb0, 0x76, 0xa7, 0xc2, 0xba, 0xf1, 0x3a, 0x71, 0x17, 0x4b,
-    0x0a, 0x56, 0xe1, 0xf3, 0xf0, 0x59, 0xba, 0x7d, 0xdc, 0x42, 0xcb, 0x05, 0x0b, 0xad, 0x5c, 0xb9,
-    0x6d, 0xb4, 0xbc, 0xd2, 0x74, 0x43, 0xa0, 0xd2, 0xca, 0x08, 0xe0, 0x3c, 0xc5, 0x80, 0xb5, 0xf7,
-    0xe2, 0xd4, 0x2e, 0xf4, 0xd6, 0x74, 0xa5, 0x40, 0x57, 0xca, 0x3b, 0x6c, 0x27, 0xa5, 0x65, 0xc9,
-    0x93, 0x00, 0x05, 0xcc, 0xa1, 0x18, 0xb0, 0x6a, 0x58, 0x06, 0xb4, 0x67, 0xba, 0xf8, 0x67, 0x2a,
-    0x0b, 0x80, 0xb2, 0xae, 0xb7, 0x35, 0xa4, 0x2d, 0x96, 0x9e, 0x63, 0x3e, 0x69, 0xc0, 0xeb, 0x1d,
-    0x00, 0x19, 0x9f, 0x02, 0xe6, 0x77, 0xdb, 0x94, 0x87, 0x9f, 0x73, 0x63, 0x57, 0xd2, 0xc5, 0x2d,
-    0x05, 0x90, 0xd2, 0x2d, 0x0d, 0xd2, 0x18, 0x57, 0x29, 0x5f, 0xcb, 0x6d, 0x15, 0xd6, 0xdb, 0x1a,
-    0x2c, 0xeb, 0x49, 0xfb, 0x90, 0xe6, 0x07, 0xe0, 0x1c, 0x6a, 0xc0, 0xc2, 0x37, 0xb3, 0x75, 0x63,
-    0x81, 0x2b, 0xe3, 0xd1, 0x1c, 0x00, 0x6e, 0x10, 0xb0, 0x32, 0xe2, 0x7b, 0xb0, 0xc6, 0x96, 0x04,
-    0xc0, 0xb6, 0xd1, 0x25, 0x04, 0xe0, 0x08, 0x2d, 0x2c, 0x00, 0x6e, 0x10, 0xb0, 0x00, 0xb8, 0x41,
-    0xc0, 0x02, 0xe0, 0x06, 0x01, 0x0b, 0x80, 0x1b, 0x04, 0x2c, 0x00, 0x6e, 0x10, 0xb0, 0x00, 0xb8,
-    0x41, 0xc0, 0x02, 0xe0, 0x06, 0x01, 0x0b, 0x80, 0x1b, 0x04, 0x2c, 0x00, 0x6e, 0x10, 0xb0, 0x00,
-    0xb8, 0x41, 0xc0, 0x02, 0xe0, 0x06, 0x01, 0x0b, 0x80, 0x1b, 0x04, 0x2c, 0x00, 0x6e, 0x10, 0xb0,
-    0x00, 0xb8, 0x41, 0xc0, 0xc2, 0x94, 0x7a, 0xcc, 0x41, 0xc6, 0xbb, 0x24, 0xd7, 0x43, 0xc0, 0x1a,
-    0x4c, 0x7b, 0x69, 0x2c, 0x17, 0x5a, 0xbd, 0xd2, 0xfc, 0xfb, 0xd4, 0xa9, 0x7f, 0x04, 0xac, 0xc1,
-    0xd2, 0x97, 0x5d, 0xc4, 0x6f, 0x05, 0x1a, 0x55, 0x26, 0x60, 0x56, 0x04, 0x2c, 0x07, 0xa4, 0x56,
-    0x57, 0xfc, 0x7f, 0xed, 0x25, 0xb1, 0x57, 0x6a, 0xa9, 0xc5, 0x2f, 0xd8, 0xd5, 0x3e, 0x0f, 0x3f,
-    0xaf, 0x52, 0x27, 0x2b, 0x22, 0x60, 0x4d, 0x42, 0xbb, 0xd8, 0xc2, 0x85, 0x18, 0xfe, 0x49, 0xaf,
-    0x45, 0x4b, 0xb7, 0xd5, 0xb6, 0x09, 0x9f, 0x1d, 0xbb, 0x27, 0x73, 0x8a, 0x5b, 0xae, 0xda, 0x2b,
-    0xdc, 0x30, 0xbf, 0xae, 0x6f, 0x7e, 0xc6, 0xf9, 0xb4, 0xae, 0x23, 0x17, 0x23, 0x56, 0x44, 0xc0,
-    0x9a, 0x48, 0xae, 0x4b, 0xd3, 0x92, 0x56, 0xcd, 0x72, 0xcf, 0xd2, 0xae, 0xb1, 0xf5, 0x5d, 0x92,
-    0x2b, 0xd6, 0xc5, 0xea, 0xe8, 0x12, 0x5e, 0xc0, 0x15, 0xba, 0x84, 0x71, 0x17, 0xb8, 0xb4, 0x2e,
-    0xaf, 0x6f, 0xf3, 0x8b, 0xd7, 0x7c, 0x0d, 0x16, 0x5f, 0x34, 0xe9, 0xb8, 0x54, 0x69, 0x9d, 0x78,
-    0x99, 0x34, 0xb6, 0x95, 0x6e, 0x23, 0xa5, 0x3d, 0x2b, 0x6b, 0x39, 0xb5, 0x7a, 0x48, 0x49, 0x75,
-    0xeb, 0xa5, 0x2e, 0xf0, 0x1d, 0x01, 0x0b, 0x53, 0x22, 0x98, 0x40, 0x42, 0x97, 0x10, 0x80, 0x1b,
-    0x4b, 0x04, 0xac, 0xcf, 0x8f, 0x8f, 0xf7, 0xd2, 0x3a, 0xbf, 0xbd, 0x7b, 0x77, 0x97, 0xd6, 0xd3,
-    0x96, 0x03, 0x98, 0x8f, 0xfb, 0x80, 0xf5, 0xf9, 0xf1, 0xf1, 0xfe, 0xdf, 0x1f, 0x7e, 0x30, 0x05,
-    0x2d, 0x00, 0xbe, 0xb9, 0x0f, 0x58, 0xb5, 0x7e, 0x7b, 0xf7, 0xee, 0x3e, 0xba, 0x0c, 0x00, 0xda,
-    0xb8, 0x0e, 0x58, 0xa1, 0x75, 0xb5, 0x6d, 0xdb, 0x66, 0x6d, 0x65, 0xfd, 0xf9, 0xf5, 0x2b, 0x41,
-    0x0b, 0x70, 0xea, 0x72, 0x37, 0x8e, 0xbe, 0x7f, 0x7a, 0xba, 0x7f, 0x7e, 0x7c, 0xbc, 0xff, 0xf6,
-    0xee, 0xdd, 0xfd, 0x7f, 0x7f, 0xfc, 0x71, 0x1f, 0x5d, 0x1e, 0xee, 0x05, 0xd2, 0x51, 0x37, 0xf3,
-    0x19, 0xfd, 0xcd, 0xad, 0xdb, 0x80, 0x15, 0xb7, 0xae, 0x82, 0xd0, 0xca, 0x7a, 0xff, 0xf4, 0x74,
-    0xcf, 0x6d, 0x1b, 0x07, 0xad, 0x03, 0x8b, 0x68, 0x32, 0xfa, 0x04, 0x98, 0x15, 0xb7, 0x35, 0x40,
-    0xe2, 0xba, 0x4b, 0xb8, 0xc7, 0xfb, 0xa7, 0xa7, 0xfb, 0x9f, 0x5f, 0xbf, 0x8e, 0x2e, 0x06, 0x80,
-    0x0a, 0x2e, 0x03, 0x96, 0xd4, 0xba, 0x0a, 0x6a, 0xbe, 0x31, 0x2c, 0xb5, 0xc4, 0x00, 0xcc, 0xc5,
-    0x65, 0xc0, 0x02, 0x70, 0x4d, 0xee, 0x1e, 0xcd, 0xa9, 0xb9, 0xdf, 0x8a, 0x16, 0x94, 0x5f, 0x8c,
-    0x61, 0x41, 0xe2, 0x6e, 0xd0, 0x9d, 0x20, 0x04, 0x5c, 0x97, 0x9b, 0x2e, 0xe1, 0xf3, 0xf3, 0xf3,
-    0xfd, 0xcc, 0xed, 0x00, 0xcc, 0x67, 0xfa, 0x16, 0x56, 0x8f, 0x80, 0x13, 0xd2, 0x78, 0x78, 0x78,
-    0xd8, 0x9d, 0x16, 0xae, 0x27, 0x9d, 0xba, 0xe7, 0xec, 0x3c, 0x47, 0xe4, 0x3f, 0xab, 0x69, 0x03,
-    0x56, 0x08, 0x32, 0x6f, 0xdf, 0xbe, 0xdd, 0xb6, 0x6d, 0xdb, 0xbe, 0x7c, 0xf9, 0xd2, 0x9c, 0x56,
-    0x48, 0x63, 0xc6, 0xc0, 0x95, 0x9b, 0xb7, 0x4a, 0x5a, 0x3e, 0xb3, 0x11, 0xe3, 0x4e, 0xb9, 0x9b,
-    0x4b, 0x7b, 0x95, 0xa5, 0x76, 0x26, 0xd8, 0xd2, 0x1c, 0x67, 0x96, 0x63, 0x9b, 0x06, 0x2a, 0x6e,
-    0xa2, 0xfd, 0x66, 0xba, 0x2e, 0xe1, 0xf3, 0xf3, 0xf3, 0xfd, 0xf9, 0xf9, 0xf9, 0xfe, 0xf6, 0xed,
-    0xdb, 0x7f, 0x03, 0x4d, 0x2f, 0x21, 0xcd, 0x90, 0x47, 0xd7, 0xc4, 0x1b, 0x95, 0x2e, 0x2a, 0x2f,
-    0xc1, 0x6a, 0xa4, 0x78, 0xa6, 0x51, 0xeb, 0xac, 0xa3, 0x47, 0x97, 0x27, 0xfe, 0x59, 0xfb, 0x39,
-    0x74, 0xd3, 0xb4, 0xb0, 0xd2, 0x16, 0xd5, 0x91, 0x66, 0x6c, 0x71, 0x85, 0xbf, 0xa2, 0xe9, 0xcf,
-    0xf0, 0x79, 0xa9, 0x25, 0x66, 0x9d, 0x75, 0x34, 0x5d, 0x3f, 0x37, 0xfb, 0x66, 0x6e, 0x56, 0x53,
-    0x6d, 0x56, 0xd4, 0xb3, 0xbb, 0x2f, 0xa5, 0xa0, 0x60, 0x69, 0xc1, 0x6a, 0xeb, 0x6b, 0xe9, 0xf7,
-    0x6e, 0xfd, 0xd2, 0xe5, 0xb3, 0x9b, 0xa2, 0x85, 0x75, 0x54, 0x8b, 0xaa, 0x24, 0x6e, 0x71, 0x9d,
-    0x9a, 0x71, 0xa5, 0xdc, 0x6b, 0xbb, 0xd2, 0x93, 0x3c, 0x0d, 0x40, 0x96, 0xd7, 0x83, 0x59, 0x5f,
-    0x15, 0x96, 0x7b, 0xb5, 0xd8, 0x4c, 0x2d, 0x9c, 0x40, 0xab, 0x83, 0x78, 0xf9, 0xb6, 0xc9, 0x75,
-    0x16, 0x2f, 0xb7, 0xa4, 0x99, 0x92, 0xf2, 0x93, 0x5e, 0x92, 0x11, 0xa7, 0x47, 0xb7, 0xaf, 0x6c,
-    0x8a, 0x16, 0xd6, 0xc3, 0xc3, 0xc3, 0xfd, 0xcc, 0x16, 0x56, 0x10, 0xc6, 0xc5, 0x66, 0x68, 0x61,
-    0x6d, 0x9b, 0xdc, 0x72, 0xd9, 0xc3, 0x3a, 0xbe, 0x53, 0xfb, 0xaa, 0xb0, 0x59, 0x02, 0xd2, 0x28,
-    0x3d, 0x03, 0xcb, 0xd5, 0xeb, 0xb2, 0xd6, 0x14, 0x01, 0x6b, 0xdb, 0xbe, 0x07, 0x8d, 0x33, 0x02,
-    0xd7, 0x6c, 0x81, 0xea, 0x28, 0x7b, 0x2f, 0x86, 0x91, 0x17, 0xd3, 0x91, 0x79, 0x6b, 0xdf, 0xbc,
-    0x59, 0xbf, 0x91, 0xeb, 0x5d, 0x36, 0x5a, 0x56, 0x76, 0xd3, 0x04, 0xac, 0xe0, 0xc8, 0xc0, 0xe5,
-    0x21, 0x50, 0xb5, 0x5c, 0x0c, 0x96, 0x96, 0xd9, 0xde, 0x96, 0x5b, 0xcd, 0xf6, 0xb3, 0xdf, 0xa5,
-    0xae, 0x95, 0xaf, 0xa5, 0xdc, 0xb9, 0x6d, 0xd2, 0xe3, 0xa2, 0x8d, 0xfd, 0x69, 0xe3, 0x67, 0x78,
-    0x6d, 0xfa, 0x47, 0x73, 0xe2, 0xf1, 0xa5, 0x96, 0x40, 0xb3, 0x77, 0xfb, 0xa3, 0x59, 0x6f, 0x6b,
-    0x28, 0x0d, 0xf4, 0x5a, 0x06, 0xcd, 0x73, 0xe9, 0x5a, 0x06, 0xed, 0x4b, 0xaf, 0x16, 0x93, 0xca,
-    0xf1, 0xcb, 0x87, 0x0f, 0xaf, 0xca, 0xda, 0xc3, 0xaf, 0x9f, 0x3e, 0xfd, 0x5f, 0xba, 0x35, 0xb7,
-    0x87, 0xd4, 0x0e, 0xb8, 0xd7, 0x1e, 0x8b, 0xb4, 0x5c, 0xb9, 0xfa, 0x91, 0x82, 0x54, 0x69, 0x6c,
-    0x6c, 0xdb, 0x8e, 0xab, 0xd7, 0x92, 0xb4, 0xde, 0xcf, 0x36, 0x7d, 0xc0, 0x0a, 0x9e, 0x9f, 0x9f,
-    0xef, 0xad, 0x01, 0x6b, 0xc6, 0x40, 0x85, 0x71, 0xb4, 0x20, 0x52, 0x0a, 0x2e, 0x18, 0x6f, 0x8a,
-    0x6f, 0x09, 0x2d, 0x5a, 0x83, 0x0e, 0xc1, 0x0a, 0x58, 0x87, 0x9b, 0x16, 0x56, 0x50, 0x73, 0x0b,
-    0x02, 0xc1, 0xca, 0xaf, 0xa3, 0x5b, 0x37, 0x2b, 0x3d, 0x61, 0x70, 0x25, 0xee, 0x02, 0xd6, 0xb6,
-    0x7d, 0xbf, 0x6f, 0x4b, 0xf3, 0xe5, 0xcb, 0x17, 0x82, 0x95, 0x73, 0x74, 0xc7, 0x20, 0x71, 0xd3,
-    0x25, 0x04, 0x00, 0x97, 0x01, 0xeb, 0xe1, 0xe1, 0xe1, 0xae, 0x3d, 0x0c, 0x4d, 0xeb, 0x0a, 0x58,
-    0x97, 0xcb, 0x80, 0x05, 0xe0, 0x9a, 0xdc, 0x06, 0x2c, 0xa9, 0x95, 0x45, 0xeb, 0x0a, 0x58, 0x9b,
-    0xdb, 0x80, 0x05, 0xe0, 0x7a, 0x5c, 0x07, 0xac, 0xb8, 0x95, 0x45, 0xeb, 0x0a, 0x58, 0x9f, 0xeb,
-    0x80, 0x05, 0xe0, 0x5a, 0xdc, 0x07, 0xac, 0xd0, 0xca, 0xa2, 0x75, 0x05, 0xac, 0xcf, 0x7d, 0xc0,
-    0xda, 0x36, 0xee, 0x68, 0x07, 0xae, 0x62, 0x89, 0x80, 0x05, 0xe0, 0x1a, 0x08, 0x58, 0x00, 0xdc,
-    0x20, 0x60, 0x01, 0x70, 0x83, 0x80, 0x05, 0xc0, 0x0d, 0x02, 0x16, 0x00, 0x37, 0x08, 0x58, 0x00,
-    0xdc, 0x20, 0x60, 0x01, 0x70, 0x83, 0x80, 0x05, 0xc0, 0x0d, 0x02, 0x16, 0x00, 0x37, 0x08, 0x58,
-    0x00, 0xdc, 0x20, 0x60, 0x5d, 0xcc, 0xcb, 0xcb, 0x8b, 0xfa, 0xce, 0xbb, 0xd5, 0x58, 0xf6, 0xb5,
-    0xa5, 0x3e, 0xae, 0x54, 0x87, 0xb3, 0x19, 0xfe, 0xe6, 0xe7, 0x3d, 0x2f, 0xa9, 0x5c, 0x81, 0xf6,
-    0x22, 0xcd, 0xd6, 0xb4, 0x4a, 0xdb, 0x4a, 0x2f, 0xe9, 0xec, 0x59, 0x86, 0x51, 0xa4, 0x97, 0xa0,
-    0xe6, 0x5e, 0x48, 0x1a, 0xaf, 0x57, 0x1b, 0x7c, 0xb4, 0x6d, 0xae, 0x7e, 0x2e, 0x9f, 0x61, 0x78,
-    0x0b, 0x2b, 0x7e, 0x8d, 0xb7, 0xf4, 0x73, 0x75, 0xf1, 0xfe, 0x5a, 0x2f, 0xb2, 0x15, 0xcb, 0xb0,
-    0x47, 0x08, 0xd4, 0xe1, 0xdf, 0xa8, 0x72, 0x5c, 0xfd, 0x5c, 0x3e, 0xc3, 0xf0, 0x16, 0x96, 0x45,
-    0xee, 0x75, 0xe3, 0xe9, 0x1b, 0x7b, 0xad, 0xaf, 0x6c, 0xf7, 0xa0, 0xf4, 0xee, 0xbc, 0x78, 0xdf,
-    0xc3, 0xb2, 0xdc, 0xab, 0xe7, 0x8f, 0x2c, 0x8b, 0xa5, 0x8c, 0x61, 0x79, 0xcf, 0x63, 0x20, 0xa5,
-    0xa7, 0xa5, 0x5f, 0x3a, 0x0f, 0xa4, 0xfa, 0xda, 0x53, 0x87, 0xb9, 0xd7, 0xd2, 0x6b, 0xe7, 0xb1,
-    0xf4, 0x59, 0x6b, 0xfe, 0x2b, 0x9a, 0x26, 0x60, 0x69, 0x7f, 0xd1, 0xb5, 0xd7, 0x87, 0x87, 0x03,
-    0x9c, 0x5e, 0xb0, 0xa5, 0x0b, 0xc4, 0xcb, 0xfb, 0xee, 0x72, 0xe5, 0x8e, 0xf7, 0x3d, 0x7c, 0x9e,
-    0xdb, 0xef, 0xbd, 0xfb, 0xdc, 0xf2, 0x6a, 0x77, 0xeb, 0xf1, 0x39, 0x4b, 0xe9, 0x3c, 0x90, 0xea,
-    0x6b, 0x4f, 0x1d, 0x5a, 0xf3, 0xd3, 0xba, 0x8e, 0x69, 0xde, 0x15, 0xbb, 0xba, 0xb4, 0x69, 0x02,
-    0x96, 0xf6, 0x97, 0xa8, 0x66, 0x3b, 0xcb, 0x5f, 0xd6, 0x59, 0xe5, 0xc6, 0x3f, 0x34, 0xb9, 0x0b,
-    0xa8, 0xb5, 0x45, 0xb0, 0x67, 0xfb, 0x52, 0x39, 0xce, 0x08, 0x52, 0xad, 0xfb, 0x20, 0xad, 0xbb,
-    0x67, 0x2c, 0xb1, 0x66, 0xb9, 0x56, 0x9e, 0x38, 0xa8, 0xb5, 0x94, 0x63, 0x45, 0xd3, 0x04, 0xac,
-    0x23, 0x79, 0x38, 0xe0, 0x47, 0x94, 0xb1, 0x65, 0x30, 0xb9, 0x65, 0xbb, 0x23, 0xb4, 0xd6, 0x47,
-    0xef, 0x16, 0x5c, 0x4b, 0x5d, 0x68, 0xad, 0xb2, 0xda, 0x32, 0x8d, 0x6a, 0x8d, 0xce, 0x6c, 0xf8,
-    0xa0, 0xfb, 0xd9, 0x66, 0xb8, 0x18, 0x8f, 0x16, 0x77, 0xc5, 0x5a, 0x4e, 0x76, 0x4f, 0x83, 0xee,
-    0x47, 0x96, 0x75, 0x6f, 0x0b, 0x27, 0x57, 0xb6, 0x5c, 0x77, 0x3e, 0xfe, 0xdc, 0xd3, 0xb1, 0x38,
-    0xc3, 0x6d, 0xdb, 0xb6, 0x8f, 0x23, 0x0b, 0x60, 0xf9, 0x2a, 0xd8, 0xb2, 0xac, 0x65, 0xf0, 0xf2,
-    0x97, 0x0f, 0x1f, 0xfe, 0xfd, 0xfd, 0x6c, 0xbf, 0x7e, 0xfa, 0x74, 0xdf, 0xb6, 0x7c, 0x17, 0xa6,
-    0x76, 0xa0, 0x3b, 0x7c, 0xa6, 0x9d, 0xe4, 0x2d, 0xf5, 0x5b, 0xaa, 0x43, 0xeb, 0xf2, 0xdc, 0xf1,
-    0x69, 0x39, 0x0e, 0xa1, 0xfe, 0xa4, 0xfc, 0xd2, 0x7c, 0xb4, 0xff, 0xe7, 0xb6, 0x95, 0x96, 0xd7,
-    0xa4, 0x53, 0x93, 0x7f, 0xd8, 0xd6, 0x52, 0xaf, 0x23, 0xcf, 0xd9, 0x6d, 0x7b, 0x5d, 0xef, 0x67,
-    0x1b, 0x1e, 0xb0, 0x00, 0xf8, 0xf9, 0x32, 0x68, 0xb4, 0xcb, 0x75, 0x09, 0x81, 0x99, 0xd0, 0xdd,
-    0xab, 0x43, 0xc0, 0xc2, 0x94, 0xae, 0x74, 0x21, 0xd3, 0xba, 0xb2, 0xbb, 0xc4, 0xb7, 0x84, 0xc0,
-    0xac, 0x08, 0x54, 0x75, 0x68, 0x61, 0x01, 0x70, 0x83, 0x80, 0x05, 0xc0, 0x0d, 0x02, 0x16, 0x00,
-    0x37, 0xdc, 0x07, 0xac, 0xf4, 0x99, 0x3a, 0xc8, 0xce, 0xac, 0x27, 0x8e, 0x09, 0x8e, 0x32, 0x7c,
-    0xd0, 0x5d, 0x3b, 0xb1, 0xad, 0x83, 0x91, 0x2b, 0xdd, 0x09, 0xdc, 0xe3, 0xdb, 0x22, 0x2d, 0x0d,
-    0xad, 0x9e, 0x5a, 0x6e, 0x4e, 0x2d, 0x39, 0xf3, 0x98, 0x68, 0x37, 0x77, 0xf6, 0xce, 0x23, 0x37,
-    0xbb, 0x43, 0x9a, 0x27, 0xb3, 0x2c, 0x1c, 0x67, 0x78, 0x0b, 0x2b, 0x7e, 0xba, 0x9f, 0x07, 0x3d,
-    0xf7, 0x6b, 0x09, 0x2e, 0x3d, 0xd3, 0x3b, 0x9b, 0x74, 0xfe, 0x9c, 0x15, 0x2c, 0xbd, 0xd7, 0x9d,
-    0x47, 0xc3, 0x03, 0x96, 0x24, 0x9d, 0x3e, 0x45, 0x6b, 0x19, 0xac, 0xd4, 0xf5, 0x90, 0x1e, 0xa9,
-    0x49, 0xeb, 0x40, 0xfa, 0x4c, 0x5b, 0x3f, 0xb7, 0x9e, 0x24, 0xce, 0x3b, 0xd7, 0xa2, 0xd0, 0xd2,
-    0x0f, 0xbf, 0x6b, 0xfb, 0x96, 0xcb, 0xfb, 0x48, 0xda, 0xfe, 0xe7, 0xea, 0x2f, 0x5d, 0x16, 0x7f,
-    0x26, 0xe5, 0x51, 0xaa, 0x3b, 0x4b, 0xbd, 0xad, 0x72, 0x1e, 0x1f, 0x6d, 0x9a, 0x80, 0x95, 0x9e,
-    0x2c, 0xd2, 0xdc, 0x44, 0xf1, 0xba, 0x57, 0x68, 0x91, 0xa5, 0xfb, 0x96, 0xd6, 0x49, 0xda, 0xa2,
-    0xd0, 0x9e, 0x4f, 0xeb, 0x51, 0x4f, 0x71, 0x5a, 0xa5, 0xe7, 0x11, 0xa5, 0xed, 0xf6, 0xe4, 0xdd,
-    0x4a, 0xab, 0x27, 0xe9, 0xa1, 0xe6, 0x52, 0x9d, 0xb6, 0xd6, 0xa1, 0xa5, 0xde, 0xce, 0x6e, 0x19,
-    0x7a, 0x36, 0x7c, 0x0c, 0x2b, 0xd0, 0x4e, 0x86, 0x95, 0x03, 0xd2, 0x6c, 0x72, 0xd3, 0x99, 0xb4,
-    0x74, 0x7f, 0xce, 0x0c, 0x56, 0xd6, 0x07, 0x9b, 0xc3, 0xe7, 0x5a, 0xd0, 0x6a, 0xcd, 0x5f, 0xab,
-    0x3b, 0xba, 0x8d, 0x7d, 0x4d, 0x13, 0xb0, 0xae, 0x2c, 0xed, 0x52, 0xcd, 0xfa, 0xa8, 0x46, 0xed,
-    0x05, 0xbd, 0x67, 0x3e, 0xa7, 0xd6, 0xb1, 0x38, 0x6d, 0xe6, 0x05, 0x4b, 0xd9, 0x8e, 0xaa, 0x73,
-    0x5a, 0x4e, 0xfd, 0x4c, 0xd3, 0x25, 0x8c, 0xd5, 0x1c, 0xe0, 0x55, 0x4e, 0x06, 0xad, 0xeb, 0xb6,
-    0xe7, 0xa2, 0x8f, 0x59, 0xeb, 0x49, 0xcb, 0x47, 0x6a, 0x91, 0x58, 0xd3, 0x3b, 0xf3, 0x18, 0xe5,
-    0xf2, 0x4b, 0xff, 0x30, 0x58, 0xd6, 0x2d, 0x2d, 0x4b, 0xf3, 0x96, 0xb6, 0x59, 0x7d, 0xe8, 0xe2,
-    0x4c, 0xc3, 0xa7, 0x97, 0xb1, 0x9c, 0xcc, 0xd2, 0x98, 0x82, 0x74, 0xd2, 0xed, 0x99, 0x5f, 0xe9,
-    0x6c, 0xda, 0x7c, 0x58, 0xb9, 0x71, 0x8e, 0x78, 0xfb, 0xd2, 0x38, 0x92, 0xa5, 0x9e, 0xb4, 0x6d,
-    0x4a, 0xe5, 0xb2, 0x94, 0x57, 0x5a, 0xa7, 0xe7, 0xf1, 0xc9, 0xcd, 0x27, 0xa6, 0x05, 0xa4, 0x5c,
-    0x3d, 0xe5, 0x96, 0x87, 0xcf, 0x2c, 0xc7, 0x20, 0x5d, 0x2e, 0xb1, 0xb4, 0x06, 0x67, 0x3d, 0x87,
-    0x99, 0x0f, 0x0b, 0xb8, 0xa8, 0x59, 0xbb, 0xfe, 0x33, 0x9b, 0xb2, 0x4b, 0x08, 0x00, 0x12, 0x02,
-    0x16, 0xa6, 0xb4, 0xca, 0xd8, 0xa4, 0xa6, 0x74, 0xef, 0x1a, 0x64, 0x7c, 0x4b, 0x08, 0x0c, 0x40,
-    0x57, 0xb0, 0x0d, 0x2d, 0x2c, 0x00, 0x6e, 0x10, 0xb0, 0x00, 0xb8, 0x41, 0xc0, 0x02, 0xe0, 0x06,
-    0x01, 0x6b, 0x31, 0x3c, 0x48, 0x7b, 0x1d, 0x57, 0x3c, 0xd6, 0xc3, 0x07, 0xdd, 0xb5, 0x1b, 0x12,
-    0xb5, 0xcf, 0x4b, 0x37, 0xef, 0xe5, 0x6e, 0xfe, 0x9b, 0x51, 0xcb, 0x4d, 0x8c, 0x39, 0x47, 0xde,
-    0x59, 0x3e, 0xe3, 0x7d, 0x43, 0xde, 0x8e, 0x77, 0xcc, 0xfa, 0x18, 0x91, 0xe6, 0x8a, 0x0f, 0x4c,
-    0x0f, 0x6f, 0x61, 0xe5, 0xe6, 0x33, 0xb2, 0xcc, 0x36, 0x10, 0x6f, 0x2f, 0xfd, 0x9c, 0x9d, 0x87,
-    0x87, 0x63, 0x67, 0xfe, 0x4b, 0xee, 0xed, 0x78, 0x07, 0x57, 0x99, 0x71, 0xa4, 0xb7, 0xe1, 0x01,
-    0x4b, 0xd3, 0xf2, 0xe4, 0xbb, 0x96, 0x8e, 0x87, 0x79, 0x87, 0xa4, 0x40, 0x1d, 0x7f, 0x6e, 0x99,
-    0x53, 0x49, 0x4a, 0xd7, 0x32, 0xdf, 0x53, 0x29, 0x0d, 0x2f, 0x17, 0x55, 0x69, 0x5f, 0xd2, 0xfd,
-    0xd7, 0xd6, 0x97, 0xea, 0x29, 0x5d, 0x3f, 0x97, 0x6e, 0x2e, 0x0d, 0x4d, 0xda, 0xba, 0xce, 0x1d,
-    0x27, 0x4d, 0x6d, 0x9e, 0x1e, 0x4d, 0x1b, 0xb0, 0x7a, 0x59, 0x61, 0xde, 0x21, 0xad, 0xec, 0x35,
-    0x73, 0x51, 0xa5, 0x7f, 0xd1, 0xb5, 0x67, 0x33, 0x3d, 0x4b, 0xf7, 0x35, 0xbd, 0xe0, 0xd3, 0xc0,
-    0x2b, 0xed, 0xbb, 0x56, 0x4f, 0xda, 0x31, 0x90, 0xd2, 0xd5, 0xd2, 0x48, 0xcb, 0xaa, 0x05, 0xc5,
-    0x5c, 0x7a, 0xa5, 0x63, 0xed, 0xf5, 0x1c, 0xb7, 0x1a, 0x3e, 0x86, 0x15, 0x94, 0x1e, 0xb6, 0xdd,
-    0x3b, 0x56, 0xe1, 0xa1, 0x85, 0xd0, 0x73, 0x4e, 0xa5, 0xd2, 0xc3, 0xba, 0x96, 0x34, 0xbc, 0xaa,
-    0xad, 0x2f, 0x4b, 0x3d, 0x59, 0xa6, 0xa9, 0xa9, 0x79, 0x00, 0x3a, 0x4e, 0x53, 0x1b, 0x1b, 0xac,
-    0xed, 0xee, 0xae, 0x1a, 0xa4, 0x62, 0xd3, 0x04, 0x2c, 0xcb, 0x49, 0x36, 0xe3, 0xa0, 0xef, 0x59,
-    0x6a, 0x4f, 0x46, 0xa9, 0xbe, 0x3c, 0xd5, 0xdd, 0xc8, 0xb2, 0x6a, 0x79, 0xe7, 0xba, 0xcc, 0x7b,
-    0xea, 0xda, 0x72, 0x6e, 0xd7, 0x04, 0xc0, 0x95, 0x4d, 0xdb, 0x25, 0x5c, 0xb9, 0x59, 0x9b, 0x93,
-    0x6b, 0x2d, 0xf5, 0xfc, 0x16, 0xe9, 0x8a, 0x75, 0x1b, 0xd4, 0xec, 0xbb, 0xd4, 0x25, 0x94, 0x3e,
-    0xaf, 0xad, 0x6b, 0x4b, 0x19, 0x4a, 0x79, 0x5b, 0xb6, 0x5d, 0xcd, 0xf0, 0xe9, 0x65, 0x4a, 0x5d,
-    0x3d, 0xeb, 0x57, 0xbf, 0xb9, 0x74, 0x72, 0x69, 0x8c, 0x9a, 0x77, 0x28, 0x37, 0x9f, 0x53, 0xba,
-    0x5c, 0x62, 0x19, 0xcf, 0x4a, 0xc7, 0xaa, 0x2c, 0xeb, 0x4b, 0x79, 0xe5, 0xba, 0x48, 0x33, 0xd5,
-    0x5f, 0x2c, 0x37, 0x4e, 0x57, 0xda, 0x77, 0xeb, 0x38, 0xa1, 0x56, 0xa7, 0xb9, 0xb4, 0xa5, 0xcf,
-    0xb5, 0x6d, 0x6b, 0xf3, 0xd6, 0xf2, 0xec, 0x79, 0x8c, 0x98, 0x0f, 0xeb, 0x04, 0x57, 0xee, 0x4a,
-    0x02, 0x2b, 0x99, 0xb6, 0x4b, 0x08, 0x00, 0xa9, 0xe5, 0x03, 0x56, 0xe9, 0x1e, 0x23, 0xcc, 0x89,
-    0xe3, 0x05, 0xc9, 0x34, 0xdf, 0x12, 0x1e, 0x85, 0xae, 0x20, 0xb0, 0x8e, 0xe5, 0x5b, 0x58, 0x00,
-    0xd6, 0x41, 0xc0, 0x02, 0xe0, 0x06, 0x01, 0x0b, 0x80, 0x1b, 0x04, 0xac, 0xc5, 0xac, 0xfe, 0xf0,
-    0x2b, 0x64, 0x57, 0x39, 0xee, 0xc3, 0x07, 0xdd, 0x4b, 0xcf, 0x6d, 0x95, 0x6e, 0x1c, 0xad, 0x79,
-    0xee, 0x6b, 0x46, 0xad, 0x37, 0x1e, 0x6a, 0x8e, 0x7a, 0x42, 0x60, 0xef, 0xb3, 0x9c, 0x47, 0xf1,
-    0x7e, 0xfc, 0x03, 0xeb, 0x0d, 0xd2, 0x9a, 0xab, 0x3c, 0x19, 0x32, 0x3c, 0x60, 0x49, 0xcf, 0x51,
-    0xc5, 0x4f, 0xdb, 0x97, 0xee, 0xfe, 0xce, 0x6d, 0x7f, 0x68, 0xc1, 0x3b, 0x29, 0x9d, 0x68, 0x33,
-    0xec, 0xc7, 0xcc, 0xf5, 0xeb, 0xfd, 0xf8, 0x6f, 0x9b, 0x5c, 0xbf, 0xe3, 0x4a, 0x33, 0xb7, 0xe1,
-    0x01, 0x4b, 0xd3, 0x32, 0x6b, 0x41, 0xbc, 0x5e, 0x3a, 0xb5, 0x8a, 0x94, 0x86, 0xf4, 0x08, 0x84,
-    0xf6, 0x38, 0xc4, 0xd1, 0x0f, 0x5f, 0xc7, 0xe9, 0x6b, 0xd3, 0xa3, 0xe4, 0xca, 0xaf, 0x95, 0xad,
-    0x54, 0x0f, 0x96, 0x34, 0x3c, 0x5d, 0xfc, 0xdb, 0xf6, 0xba, 0x2e, 0xe3, 0xe5, 0xe1, 0xf7, 0x9a,
-    0xba, 0x28, 0xad, 0x1b, 0xe7, 0xdd, 0xfa, 0xf8, 0x53, 0x5a, 0x7e, 0x6b, 0x39, 0xb5, 0x34, 0x66,
-    0x6d, 0x11, 0xef, 0x35, 0x6d, 0xc0, 0xea, 0x25, 0xf7, 0xd7, 0xd7, 0xda, 0xba, 0x09, 0xe3, 0x03,
-    0xa3, 0x66, 0x8c, 0x48, 0x2f, 0x9e, 0xb4, 0xfc, 0xb9, 0x87, 0x6e, 0xb5, 0x29, 0x4c, 0xe2, 0x07,
-    0x6a, 0x6b, 0xc6, 0x3f, 0x3c, 0xb5, 0x5e, 0x2c, 0x2d, 0x77, 0xe9, 0x79, 0xbc, 0xf4, 0x0f, 0x45,
-    0xcd, 0x1f, 0xb9, 0x34, 0x5d, 0x4b, 0xeb, 0x4f, 0x7a, 0xee, 0xd1, 0x92, 0x9e, 0xe5, 0x8f, 0x54,
-    0x6e, 0x3d, 0x8f, 0xa6, 0x09, 0x58, 0xb9, 0x07, 0x39, 0xa5, 0xcf, 0x8f, 0xc8, 0x7f, 0x74, 0x2b,
-    0x43, 0xcb, 0xbf, 0x94, 0xb7, 0xe5, 0xa4, 0x0d, 0xcb, 0x6a, 0xd2, 0xb0, 0xa4, 0x39, 0x3b, 0xcb,
-    0x43, 0xe4, 0xa5, 0x65, 0xd6, 0xf1, 0xa5, 0xf8, 0xf8, 0xd5, 0x76, 0xf1, 0x4a, 0x41, 0x28, 0xfe,
-    0x23, 0x55, 0x4a, 0xcb, 0x9a, 0xa7, 0x47, 0xd3, 0x04, 0x2c, 0xcb, 0x45, 0xe9, 0xf1, 0x82, 0xe9,
-    0xa5, 0xf6, 0x04, 0x94, 0xea, 0x6b, 0x4f, 0xdd, 0x9d, 0x5d, 0xf7, 0xbd, 0xf2, 0xea, 0x91, 0x8e,
-    0xf6, 0x07, 0x41, 0x5b, 0x77, 0x4f, 0xbd, 0x5b, 0xce, 0xf3, 0x9a, 0x00, 0xb8, 0x9a, 0x69, 0x6f,
-    0x6b, 0xd8, 0xf3, 0xad, 0x47, 0xcd, 0xc5, 0x95, 0x9e, 0x20, 0xa3, 0x03, 0x63, 0xae, 0xb5, 0xd4,
-    0xf3, 0x9b, 0xa3, 0x9a, 0xba, 0xf5, 0x36, 0x28, 0x9c, 0xeb, 0x2a, 0x59, 0x96, 0x95, 0xd2, 0xd6,
-    0x8e, 0x47, 0x3a, 0x06, 0xa6, 0x6d, 0xdf, 0x52, 0x86, 0xb4, 0x4b, 0x58, 0x73, 0x2e, 0xcc, 0x7e,
-    0xbc, 0x6a, 0x0c, 0x9f, 0x5e, 0xa6, 0xd4, 0xd5, 0x2b, 0x35, 0xc7, 0x2d, 0x5f, 0x6b, 0x5b, 0xf2,
-    0x28, 0x8d, 0x1d, 0x84, 0x6d, 0xd3, 0xb1, 0x86, 0xd6, 0xb9, 0x86, 0x98, 0x0f, 0x6b, 0x9f, 0xdc,
-    0x7c, 0x58, 0xa5, 0x41, 0xeb, 0x78, 0x79, 0xcd, 0xba, 0x61, 0xb9, 0x96, 0x67, 0xcd, 0x00, 0x7f,
-    0x2c, 0x77, 0x8e, 0x4b, 0x63, 0x66, 0x96, 0xbc, 0xb5, 0x3c, 0xf7, 0x1e, 0x2f, 0xe6, 0xc3, 0x02,
-    0x00, 0xa3, 0x69, 0xbb, 0x84, 0x00, 0x90, 0x22, 0x60, 0x61, 0x4a, 0x2b, 0x8d, 0xbb, 0xa0, 0x1f,
-    0x02, 0x16, 0x00, 0x37, 0x08, 0x58, 0x00, 0xdc, 0x20, 0x60, 0x01, 0x70, 0x83, 0x80, 0x05, 0xc0,
-    0x0d, 0x02, 0x16, 0x00, 0x37, 0xb8, 0x0f, 0x0b, 0x80, 0x1b, 0xb4, 0xb0, 0x00, 0xb8, 0x41, 0xc0,
-    0x02, 0xe0, 0x06, 0x01, 0x0b, 0x80, 0x1b, 0x04, 0x2c, 0x00, 0x6e, 0x10, 0xb0, 0x00, 0xb8, 0x41,
-    0xc0, 0x02, 0xe0, 0x06, 0x01, 0x0b, 0x80, 0x1b, 0x04, 0x2c, 0x00, 0x6e, 0x10, 0xb0, 0x00, 0xb8,
-    0x41, 0xc0, 0x02, 0xe0, 0x06, 0x01, 0x0b, 0x80, 0x1b, 0x04, 0x2c, 0x00, 0x6e, 0x10, 0xb0, 0x00,
-    0xb8, 0x41, 0xc0, 0x02, 0xe0, 0x06, 0x01, 0x0b, 0x80, 0x1b, 0x53, 0x04, 0xac, 0xf0, 0x36, 0xdd,
-    0xf0, 0x2f, 0x2c, 0xdb, 0x93, 0x5e, 0xa7, 0xa2, 0x01, 0x98, 0xc8, 0x9b, 0xd1, 0x05, 0xf0, 0xf6,
-    0x1a, 0x74, 0x00, 0xe3, 0x4c, 0xd1, 0xc2, 0x8a, 0xc5, 0xaf, 0xd9, 0x8e, 0x5b, 0x5c, 0xa5, 0xff,
-    0x4b, 0x3f, 0x09, 0x7e, 0xc0, 0x5a, 0xa6, 0x98, 0x22, 0x39, 0x04, 0x96, 0xb4, 0xa5, 0xa5, 0xfd,
-    0x3f, 0xfd, 0x3d, 0xac, 0x23, 0x7d, 0x2e, 0xfd, 0x1f, 0x80, 0x4f, 0xc3, 0xbb, 0x84, 0xdb, 0xa6,
-    0x07, 0x1a, 0x69, 0x9d, 0xda, 0xcf, 0x00, 0xac, 0x63, 0xaa, 0x2e, 0x61, 0xdc, 0x1d, 0x94, 0xb4,
-    0x76, 0xf3, 0x08, 0x68, 0xc0, 0x1a, 0x86, 0x07, 0xac, 0x52, 0x00, 0x8a, 0xc7, 0xa4, 0x6e, 0xb7,
-    0x5b, 0x55, 0xd7, 0xae, 0xc7, 0x37, 0x8e, 0x00, 0xe6, 0x31, 0x7c, 0x0c, 0x2b, 0x0d, 0x26, 0xb9,
-    0x71, 0xab, 0x5c, 0x3a, 0x69, 0x20, 0xd3, 0xc6, 0xbc, 0x00, 0xf8, 0x35, 0x3c, 0x60, 0x01, 0x80,
-    0xd5, 0xf0, 0x2e, 0x21, 0x00, 0x58, 0x11, 0xb0, 0x00, 0xb8, 0x41, 0xc0, 0x02, 0xe0, 0x06, 0x01,
-    0x0b, 0x80, 0x1b, 0x04, 0x2c, 0x00, 0x6e, 0x10, 0xb0, 0x00, 0xb8, 0x41, 0xc0, 0x3a, 0x89, 0xf7,
-    0x87, 0xb1, 0xbd, 0x97, 0xdf, 0x6a, 0xd4, 0x7e, 0x5e, 0xa5, 0x7e, 0xf7, 0x72, 0x1f, 0xb0, 0xd2,
-    0xb9, 0xb4, 0x66, 0x3d, 0xe8, 0xd2, 0x8d, 0xad, 0x3d, 0xd3, 0x4f, 0xd3, 0x3b, 0xa2, 0x1e, 0xc2,
-    0xa3, 0x53, 0x52, 0x3d, 0xcf, 0x5e, 0xff, 0x9a, 0xdc, 0x8d, 0xcb, 0xa5, 0x75, 0x7b, 0xda, 0x7b,
-    0x63, 0xb3, 0xb7, 0x7a, 0x6f, 0xe5, 0x3e, 0x60, 0x85, 0x03, 0x1d, 0x1e, 0xdb, 0x29, 0x3d, 0x8f,
-    0x38, 0x8b, 0xa3, 0xef, 0xbc, 0xef, 0x99, 0x7e, 0xfc, 0xa4, 0x40, 0x29, 0xdd, 0x15, 0x9e, 0x28,
-    0xf0, 0x72, 0x0e, 0x5d, 0xd1, 0x14, 0xb3, 0x35, 0x1c, 0x21, 0x9e, 0xb2, 0xa6, 0x34, 0x1d, 0x8d,
-    0xb6, 0x5c, 0x5b, 0x57, 0xca, 0xa3, 0x54, 0x8e, 0xdc, 0x76, 0x35, 0x65, 0xcd, 0x2d, 0xd3, 0x5a,
-    0x0b, 0xb9, 0x6d, 0xd2, 0x3c, 0xad, 0xe2, 0xed, 0xe2, 0x9f, 0xd2, 0x7e, 0xc6, 0xf9, 0x4a, 0x79,
-    0xe7, 0xca, 0x9a, 0xab, 0x9b, 0x5c, 0xab, 0xd5, 0xb2, 0x9f, 0x69, 0xbd, 0x59, 0x8e, 0xa3, 0x54,
-    0xf6, 0xdc, 0xb6, 0x35, 0xe7, 0x5b, 0xeb, 0xb6, 0xa5, 0xfd, 0xb0, 0xec, 0x9f, 0x17, 0xcb, 0x06,
-    0xac, 0xb8, 0xfb, 0x12, 0x96, 0x69, 0xf3, 0x64, 0x49, 0x41, 0xa2, 0xf4, 0x1c, 0xa3, 0xe5, 0x59,
-    0x45, 0xed, 0x02, 0x91, 0x4e, 0x76, 0x4b, 0x59, 0xc3, 0xba, 0x69, 0x99, 0x4a, 0x17, 0xa3, 0xb4,
-    0xcf, 0x71, 0x9e, 0xad, 0x41, 0x2b, 0x27, 0x37, 0x27, 0x99, 0x76, 0xb1, 0xe7, 0x8e, 0x4f, 0x1a,
-    0x14, 0x4b, 0x01, 0xcc, 0xb2, 0x9f, 0x35, 0xfb, 0x6d, 0xcd, 0x4f, 0xab, 0x03, 0xcb, 0x79, 0x68,
-    0xa9, 0x3f, 0x29, 0xcd, 0xdc, 0x7e, 0xac, 0xf6, 0x4c, 0xed, 0x32, 0x01, 0x4b, 0xfb, 0x6b, 0x64,
-    0x19, 0x3b, 0x8a, 0x0f, 0xb8, 0x74, 0x32, 0x4b, 0x07, 0xf9, 0x88, 0x03, 0x5f, 0x33, 0xce, 0xd5,
-    0x2b, 0xff, 0x3d, 0xe9, 0x1c, 0x15, 0xe8, 0xb4, 0xbc, 0xa4, 0xdf, 0x2d, 0xdb, 0xe6, 0xb6, 0x39,
-    0x52, 0xee, 0x1c, 0xb2, 0x74, 0x39, 0x4b, 0xeb, 0x58, 0x03, 0x6d, 0x69, 0x1d, 0x4f, 0x96, 0x09,
-    0x58, 0xd6, 0x03, 0xa3, 0xad, 0x27, 0x5d, 0x7c, 0xa5, 0x0b, 0xf2, 0xe8, 0x71, 0x8e, 0xa3, 0x07,
-    0xea, 0x67, 0xb4, 0x37, 0x80, 0xf6, 0x2b, 0x49, 0x1f, 0xda, 0x39, 0x74, 0x66, 0xb0, 0x59, 0xe9,
-    0xbc, 0x71, 0x3f, 0xe8, 0xbe, 0x47, 0x6e, 0x5c, 0x42, 0xeb, 0xbe, 0xc5, 0xdb, 0x6a, 0xad, 0xaf,
-    0x5c, 0x5e, 0x7b, 0xcb, 0x5a, 0x4a, 0xef, 0xec, 0x93, 0xb3, 0xf5, 0xa2, 0xb2, 0xb4, 0xce, 0xf6,
-    0xec, 0x4b, 0xed, 0xb6, 0x35, 0xeb, 0x5b, 0xd7, 0x2d, 0x9d, 0x43, 0x35, 0xe9, 0xe5, 0xc6, 0x42,
-    0x73, 0xcb, 0x6a, 0xcf, 0xd3, 0xd9, 0xb9, 0x9f, 0x5e, 0xa6, 0x76, 0x50, 0xb3, 0x76, 0x20, 0x3b,
-    0xdd, 0x5e, 0x4a, 0xc7, 0xb2, 0x9e, 0x76, 0xd2, 0xe6, 0x06, 0x6f, 0x4b, 0x83, 0xc8, 0x52, 0x5e,
-    0xda, 0xf8, 0x98, 0x96, 0x4e, 0xba, 0x8e, 0x65, 0x1c, 0xa4, 0xb6, 0xac, 0x96, 0x74, 0xb5, 0x74,
-    0x72, 0xe5, 0x2c, 0x8d, 0xeb, 0x59, 0xf7, 0xd3, 0x32, 0x86, 0x24, 0x2d, 0xaf, 0x39, 0x47, 0x6a,
-    0xf7, 0x33, 0xb7, 0xbd, 0x76, 0xac, 0x4a, 0xf5, 0x99, 0x2b, 0xab, 0x17, 0xee, 0x03, 0x16, 0x8e,
-    0xb7, 0xc2, 0x60, 0x6d, 0xad, 0x2b, 0xee, 0xb3, 0x07, 0x97, 0xee, 0x12, 0xc2, 0xa6, 0xd4, 0xa5,
-    0x59, 0x0d, 0xc1, 0x6a, 0x5e, 0x04, 0x2c, 0x98, 0x5d, 0x21, 0x68, 0x5d, 0x61, 0x1f, 0x3d, 0xa3,
-    0x4b, 0x08, 0xc0, 0x0d, 0x5a, 0x58, 0x00, 0xdc, 0x20, 0x60, 0x01, 0x70, 0x83, 0x80, 0x05, 0xc0,
-    0x0d, 0x02, 0x56, 0x85, 0xf4, 0x79, 0x3f, 0xd4, 0xa3, 0x0e, 0xb1, 0x07, 0x01, 0x2b, 0xd2, 0xe3,
-    0xd9, 0x2d, 0x0f, 0x46, 0x06, 0x0c, 0xeb, 0x4d, 0xb8, 0xad, 0xac, 0x4f, 0x04, 0xc0, 0x27, 0x02,
-    0x16, 0x86, 0x3b, 0xf2, 0x0f, 0xc1, 0x2a, 0x7f, 0x64, 0xf0, 0x8d, 0xfb, 0x87, 0x9f, 0x6b, 0x1f,
-    0xd5, 0x90, 0xb6, 0x29, 0x3d, 0x43, 0x58, 0x3a, 0xe9, 0x73, 0x53, 0x9e, 0x48, 0xf9, 0x6b, 0x9f,
-    0x59, 0xa7, 0x4e, 0xd1, 0xf2, 0xb7, 0xa6, 0x95, 0x6e, 0x93, 0x5b, 0xaf, 0xa6, 0xdc, 0xd2, 0xfa,
-    0xd2, 0x76, 0xd2, 0x72, 0xe9, 0xb1, 0x9b, 0xda, 0xc7, 0x81, 0x72, 0xfb, 0x66, 0x49, 0xe7, 0x88,
-    0xd9, 0x27, 0xd0, 0xd7, 0x12, 0xf7, 0x61, 0x69, 0x81, 0x2a, 0xf7, 0xbc, 0x98, 0x76, 0xe1, 0xd5,
-    0xfc, 0x2e, 0x95, 0x21, 0xa4, 0x27, 0xe5, 0xa7, 0xa5, 0xa1, 0x05, 0x0a, 0xcb, 0x85, 0x54, 0x93,
-    0x56, 0x2e, 0x7f, 0xad, 0xec, 0xa5, 0xdf, 0x73, 0xf9, 0x5b, 0xca, 0xa8, 0x95, 0xb9, 0x54, 0x8f,
-    0xd6, 0xe3, 0x63, 0x2d, 0x27, 0x41, 0xcb, 0x07, 0xf7, 0x2d, 0xac, 0xa0, 0xe5, 0x04, 0xcb, 0x6d,
-    0xd3, 0x3b, 0xbd, 0xd6, 0x74, 0x2c, 0x69, 0xe6, 0xc6, 0x69, 0xac, 0x65, 0xaa, 0xcd, 0x53, 0x0b,
-    0x78, 0x3d, 0x58, 0x1e, 0xe0, 0xcd, 0xad, 0xdf, 0x2b, 0x5f, 0xcc, 0x67, 0x99, 0x80, 0x75, 0x04,
-    0x2f, 0x03, 0xb6, 0x47, 0x5c, 0x68, 0x35, 0xfb, 0x7e, 0xf4, 0x85, 0x4e, 0x20, 0x41, 0xc0, 0xa0,
-    0xbb, 0x20, 0x7c, 0xf5, 0x7e, 0xbb, 0xf9, 0x9b, 0x47, 0xa8, 0x26, 0xd0, 0xe4, 0xc6, 0x95, 0x4a,
-    0xfb, 0x5e, 0x1a, 0x93, 0xea, 0x51, 0x3e, 0xeb, 0xf6, 0xd6, 0x65, 0xf0, 0x6f, 0xa9, 0x31, 0xac,
-    0xa0, 0x65, 0xee, 0xa6, 0xf8, 0x33, 0xcb, 0xec, 0x04, 0x96, 0xf4, 0x5a, 0x07, 0xdd, 0xc3, 0x32,
-    0xeb, 0x17, 0x00, 0xb5, 0x69, 0x69, 0xfb, 0x29, 0x6d, 0xab, 0x7d, 0x66, 0xdd, 0xcf, 0x74, 0x1d,
-    0x6d, 0xbf, 0xb4, 0xfc, 0x72, 0xe9, 0xe7, 0xbe, 0x18, 0x90, 0xf6, 0xad, 0x76, 0xf0, 0xde, 0xdb,
-    0x1f, 0xab, 0x2b, 0x58, 0x26, 0x60, 0x71, 0x72, 0x01, 0xeb, 0xa3, 0x4b, 0x08, 0xc0, 0x0d, 0xf7,
-    0x01, 0x4b, 0xbb, 0xf7, 0x06, 0xc0, 0x7a, 0x96, 0xe8, 0x12, 0x02, 0xb8, 0x06, 0xf7, 0x2d, 0x2c,
-    0x00, 0xd7, 0x41, 0xc0, 0x02, 0xe0, 0x06, 0x01, 0x0b, 0x80, 0x1b, 0x04, 0x2c, 0x00, 0x6e, 0x10,
-    0xb0, 0x00, 0xb8, 0x41, 0xc0, 0x02, 0xe0, 0x06, 0x01, 0x0b, 0x80, 0x1b, 0x04, 0x2c, 0x00, 0x6e,
-    0x10, 0xb0, 0x00, 0xb8, 0x41, 0xc0, 0x02, 0xe0, 0x06, 0x01, 0x0b, 0x80, 0x1b, 0x04, 0x2c, 0x00,
-    0x6e, 0x10, 0xb0, 0x00, 0xb8, 0x41, 0xc0, 0x02, 0xe0, 0x06, 0x01, 0x0b, 0x80, 0x1b, 0x04, 0x2c,
-    0x00, 0x6e, 0x10, 0xb0, 0x00, 0xb8, 0x41, 0xc0, 0x02, 0xe0, 0x06, 0x2f, 0x52, 0x1d, 0xec, 0xf3,
-    0xe3, 0xe3, 0xdd, 0xb2, 0xde, 0xfb, 0xa7, 0x27, 0xd3, 0x7a, 0xc0, 0xca, 0x68, 0x61, 0x15, 0x84,
-    0x97, 0xaa, 0x8e, 0x2e, 0x07, 0x80, 0x09, 0x5a, 0x58, 0x96, 0x97, 0x70, 0x5a, 0xd3, 0x29, 0xbd,
-    0x64, 0xd4, 0x9a, 0x4f, 0x9c, 0x96, 0xe5, 0xa5, 0xaa, 0x3d, 0x68, 0x2d, 0x28, 0x6b, 0x0b, 0x0c,
-    0xb8, 0x82, 0xe1, 0x2d, 0xac, 0x38, 0x30, 0x1c, 0x9d, 0x7e, 0xf8, 0x47, 0x8b, 0x09, 0xf0, 0x69,
-    0x78, 0xc0, 0xca, 0xd1, 0xba, 0x63, 0x61, 0x79, 0xfa, 0x4e, 0xc2, 0xda, 0xee, 0x9b, 0xb4, 0x7e,
-    0x2e, 0x2d, 0x02, 0x1d, 0x30, 0xd6, 0xb4, 0x01, 0x2b, 0x74, 0xcb, 0xd2, 0x16, 0x51, 0xbc, 0x3c,
-    0x2c, 0x4b, 0x5b, 0x51, 0x7b, 0xd2, 0xd7, 0xd2, 0x0a, 0xeb, 0x13, 0xc4, 0x80, 0x71, 0x86, 0x8f,
-    0x61, 0x69, 0xb4, 0xc0, 0x13, 0x82, 0x46, 0x4d, 0x70, 0xda, 0xb6, 0xfd, 0x63, 0x65, 0x47, 0x75,
-    0x59, 0x01, 0xd8, 0x4d, 0x1b, 0xb0, 0xb6, 0x4d, 0x6f, 0xbd, 0xc4, 0x41, 0xcb, 0x9a, 0x96, 0x75,
-    0x40, 0xbe, 0xd6, 0xd1, 0x81, 0x8c, 0xdb, 0x19, 0x80, 0xef, 0xa6, 0x0b, 0x58, 0x71, 0xd7, 0x2b,
-    0x04, 0x03, 0xad, 0x4b, 0x28, 0x05, 0x2d, 0x6b, 0x20, 0xd3, 0xd2, 0xaf, 0x4d, 0xab, 0x36, 0x70,
-    0x6a, 0x3c, 0x7d, 0x1b, 0xf8, 0xfe, 0xe9, 0xe9, 0x9e, 0x96, 0xb7, 0xb4, 0x2c, 0xfc, 0x4e, 0x00,
-    0xc6, 0x1e, 0xc3, 0xc7, 0xb0, 0x4a, 0x83, 0xdc, 0xe9, 0xc0, 0x7a, 0xbc, 0x3c, 0x1d, 0xc7, 0xd2,
-    0x02, 0x58, 0xba, 0x7d, 0x29, 0xfd, 0x38, 0x2d, 0x2d, 0xff, 0xea, 0x1d, 0x05, 0xb0, 0xdb, 0x6d,
-    0xdb, 0xb6, 0x8f, 0xa3, 0x0b, 0x01, 0x00, 0x16, 0xc3, 0x5b, 0x58, 0xc8, 0xfb, 0xfc, 0xf8, 0xf8,
-    0xaa, 0xab, 0x05, 0x5c, 0x15, 0x2d, 0x2c, 0x00, 0x6e, 0xd0, 0xc2, 0x02, 0xe0, 0x06, 0x01, 0x0b,
-    0x80, 0x1b, 0x04, 0x2c, 0x00, 0x6e, 0x4c, 0x77, 0x1f, 0xd6, 0xd5, 0xfc, 0xfd, 0xd7, 0xcf, 0x77,
-    0xcb, 0x7a, 0x3f, 0xfe, 0xf4, 0xbb, 0x69, 0x3d, 0x60, 0x65, 0x97, 0x6b, 0x61, 0x1d, 0x35, 0xbf,
-    0x15, 0xf3, 0x66, 0x01, 0xc7, 0x1b, 0xde, 0xc2, 0x6a, 0x99, 0xaf, 0x2a, 0x97, 0x56, 0x69, 0x5b,
-    0xeb, 0x03, 0xcc, 0xb5, 0x77, 0xcb, 0xef, 0x9d, 0xb6, 0x46, 0x6b, 0x41, 0x59, 0x5b, 0x60, 0xc0,
-    0x15, 0x0c, 0x6f, 0x61, 0xcd, 0x30, 0x5f, 0xd5, 0x0c, 0x65, 0x00, 0x50, 0x36, 0x3c, 0x60, 0xe5,
-    0xa4, 0xf3, 0x5e, 0xa5, 0xcb, 0xc3, 0xef, 0xe9, 0xcf, 0xd6, 0xf9, 0xb1, 0x4a, 0xe5, 0x48, 0x97,
-    0x95, 0x3e, 0x03, 0xd0, 0xd7, 0xb4, 0x01, 0x2b, 0x7e, 0xc8, 0x59, 0x9b, 0xb3, 0x2a, 0x37, 0x8f,
-    0x95, 0x36, 0xdf, 0xd5, 0x9e, 0x72, 0x30, 0x6f, 0x16, 0x30, 0xd6, 0xf0, 0x31, 0xac, 0x40, 0x7a,
-    0xf8, 0xb8, 0xb4, 0x4d, 0x6e, 0x9c, 0xa9, 0x65, 0x1c, 0x4c, 0x0b, 0x48, 0x35, 0x69, 0x30, 0x6f,
-    0x16, 0x70, 0x9c, 0x69, 0x02, 0xd6, 0x11, 0x17, 0x7a, 0x6d, 0xab, 0x46, 0x2b, 0xc3, 0xc8, 0x79,
-    0xb3, 0xb8, 0x9d, 0x01, 0xf8, 0x6e, 0x9a, 0x80, 0xd5, 0x53, 0x08, 0x30, 0xa5, 0xf9, 0xae, 0xac,
-    0x69, 0x9d, 0x31, 0x6f, 0x96, 0xa7, 0x6f, 0x03, 0x7f, 0xfc, 0xe9, 0xf7, 0x7b, 0x5a, 0xde, 0xd2,
-    0xb2, 0xf0, 0x3b, 0x01, 0x18, 0x7b, 0x0c, 0x1f, 0xc3, 0xd2, 0xe6, 0xab, 0x0a, 0xdd, 0x42, 0x69,
-    0xee, 0xab, 0xd2, 0x36, 0x71, 0x80, 0xc9, 0x0d, 0xce, 0x97, 0xd2, 0x8b, 0x3f, 0x67, 0xde, 0x2c,
-    0x60, 0x3c, 0x66, 0x6b, 0x00, 0xe0, 0xc6, 0xf0, 0x16, 0x16, 0xf2, 0xfe, 0xfe, 0xeb, 0xe7, 0x57,
-    0x5d, 0x2d, 0xe0, 0xaa, 0x68, 0x61, 0x01, 0x70, 0x83, 0x16, 0x16, 0x00, 0x37, 0x08, 0x58, 0x00,
-    0xdc, 0x20, 0x60, 0x01, 0x70, 0x83, 0x80, 0x05, 0xc0, 0x0d, 0x02, 0x16, 0x00, 0x37, 0x08, 0x58,
-    0x00, 0xdc, 0x20, 0x60, 0x01, 0x70, 0x83, 0x80, 0x05, 0xc0, 0x0d, 0x02, 0x16, 0x00, 0x37, 0x08,
-    0x58, 0x00, 0xdc, 0x20, 0x60, 0x01, 0x70, 0x83, 0x80, 0x05, 0xc0, 0x0d, 0x02, 0x16, 0x00, 0x37,
-    0x08, 0x58, 0x00, 0xdc, 0x20, 0x60, 0x01, 0x70, 0x83, 0x80, 0x05, 0xc0, 0x0d, 0x02, 0x16, 0x00,
-    0x37, 0x08, 0x58, 0x00, 0xdc, 0x20, 0x60, 0x01, 0x70, 0x83, 0x80, 0x05, 0xc0, 0x0d, 0x02, 0x16,
-    0x00, 0x37, 0x08, 0x58, 0x00, 0xdc, 0x20, 0x60, 0x01, 0x70, 0x83, 0x80, 0x05, 0xc0, 0x0d, 0x02,
-    0x16, 0x00, 0x37, 0x08, 0x58, 0x00, 0xdc, 0x20, 0x60, 0x01, 0x70, 0x83, 0x80, 0x05, 0xc0, 0x8d,
-    0x2e, 0x01, 0xeb, 0xe5, 0xe5, 0xe5, 0xbe, 0x77, 0xfb, 0x52, 0x1a, 0x96, 0x75, 0x7a, 0x6c, 0x03,
-    0xe0, 0xb5, 0xbd, 0xd7, 0x52, 0xaf, 0xeb, 0xf0, 0xcd, 0xde, 0x04, 0x5a, 0x82, 0x48, 0xfc, 0xff,
-    0xdb, 0xed, 0x76, 0xbf, 0xdd, 0x6e, 0xc5, 0xca, 0xb0, 0xac, 0x63, 0xdd, 0x26, 0x5e, 0x96, 0xae,
-    0x73, 0xbb, 0xdd, 0xaa, 0xf2, 0xb0, 0x3a, 0x23, 0x0f, 0x40, 0x23, 0x5d, 0x77, 0x35, 0xdb, 0xb7,
-    0x5c, 0x7f, 0x52, 0x19, 0xf6, 0x9e, 0xfb, 0xbb, 0x5a, 0x58, 0x2d, 0xc1, 0x2a, 0x04, 0xa8, 0x91,
-    0x17, 0x6d, 0xc8, 0x5b, 0xfb, 0xd9, 0x5b, 0xba, 0xdf, 0xb4, 0xfa, 0x70, 0xa6, 0x59, 0xae, 0xbb,
-    0x50, 0x96, 0x3d, 0xdb, 0x37, 0xb7, 0xb0, 0xd2, 0x8c, 0xb5, 0x82, 0x84, 0x0a, 0x92, 0xa2, 0xab,
-    0x56, 0x79, 0xa5, 0xd6, 0x48, 0xf8, 0x3c, 0xfe, 0x4c, 0x5a, 0x66, 0x95, 0x96, 0x4d, 0xca, 0x3f,
-    0x4e, 0x3f, 0xcd, 0x2b, 0x57, 0x5e, 0x6d, 0xbf, 0xc3, 0xf2, 0x34, 0xdd, 0xd1, 0x27, 0x14, 0xd6,
-    0x57, 0x3a, 0x6f, 0x2d, 0xd7, 0x52, 0x69, 0xdb, 0x9c, 0x3d, 0xe7, 0x79, 0x53, 0x0b, 0xeb, 0xc8,
-    0x16, 0x42, 0xa9, 0x35, 0x12, 0x7f, 0x1e, 0x3e, 0x93, 0x96, 0xd5, 0xe6, 0x57, 0xca, 0x5f, 0x0b,
-    0xb6, 0xf1, 0xfa, 0xb5, 0xfb, 0x2a, 0xa5, 0x43, 0xeb, 0x0b, 0xbd, 0x85, 0xf3, 0x2a, 0x3e, 0xb7,
-    0xb4, 0xf3, 0xd6, 0x72, 0x2d, 0xf5, 0xe8, 0x31, 0xb4, 0x9e, 0xe7, 0x4d, 0x2d, 0xac, 0x5e, 0xfd,
-    0xd9, 0x38, 0xbd, 0x9a, 0xbc, 0x2d, 0xcb, 0x6a, 0xcb, 0x60, 0x59, 0xae, 0x95, 0x67, 0x6f, 0xd0,
-    0x0a, 0xe9, 0xb4, 0x6e, 0x0b, 0x94, 0x58, 0x7b, 0x3a, 0xd6, 0xf3, 0x70, 0xef, 0xf5, 0xdf, 0x7a,
-    0xbe, 0x37, 0x77, 0x09, 0xf7, 0x0e, 0x56, 0xf7, 0xee, 0x02, 0xb5, 0x54, 0xa0, 0x76, 0x10, 0x47,
-    0xef, 0x0b, 0x70, 0x14, 0x4b, 0x63, 0xc3, 0x72, 0x2d, 0x69, 0xe7, 0x7a, 0xeb, 0x30, 0x8f, 0xd5,
-    0xae, 0x41, 0xf7, 0xda, 0x96, 0xd1, 0x51, 0xdd, 0x9d, 0x1e, 0xdd, 0x32, 0x4b, 0x6b, 0x4b, 0x0a,
-    0x4c, 0xd2, 0xd8, 0x56, 0x29, 0x6d, 0x82, 0x1b, 0xce, 0x54, 0x13, 0xa0, 0x5a, 0xae, 0xa5, 0xda,
-    0x1e, 0x89, 0x75, 0x5d, 0x71, 0xfb, 0x6d, 0xdb, 0x3e, 0xee, 0x49, 0x60, 0xdb, 0xea, 0x2e, 0x40,
-    0xe9, 0xeb, 0x55, 0xeb, 0x6d, 0x06, 0xda, 0x57, 0xb3, 0x96, 0x40, 0x91, 0x1b, 0x54, 0xaf, 0xb9,
-    0xcd, 0xc1, 0x32, 0x40, 0x2f, 0xa9, 0x2d, 0x0b, 0x01, 0x0d, 0xbd, 0x94, 0xae, 0x9b, 0xd2, 0xa0,
-    0x79, 0xed, 0x35, 0xa2, 0x95, 0xa1, 0xc7, 0x39, 0xdd, 0x25, 0x60, 0x5d, 0x09, 0xad, 0x23, 0x60,
-    0x1c, 0x1e, 0xcd, 0x31, 0xe2, 0xdb, 0x3b, 0x60, 0x3c, 0x02, 0x56, 0x05, 0x5a, 0x57, 0xc0, 0x58,
-    0x74, 0x09, 0x01, 0xb8, 0xf1, 0x0f, 0x39, 0x49, 0x67, 0xe9, 0xd0, 0xc0, 0x4e, 0x87, 0x00, 0x00,
-    0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+    0x13, 0x82, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0xdd, 0x41, 0x6e, 0xe4, 0x38, 0x12, 0x46,
+    0xe1, 0xba, 0x51, 0x01, 0xbd, 0x98, 0x3b, 0x75, 0x5d, 0xa2, 0x4f, 0xd2, 0x37, 0x98, 0x73, 0xd5,
+    0x01, 0x66, 0x3b, 0x0b, 0x0f, 0x1a, 0x18, 0x03, 0x86, 0x91, 0x12, 0x23, 0x82, 0xa4, 0x92, 0x94,
+    0x3e, 0x03, 0x0f, 0x5d, 0x6d, 0x3b, 0x9d, 0x99, 0x14, 0xf5, 0x44, 0x32, 0x19, 0xbf, 0x7e, 0xfc,
+    0xf8, 0xf1, 0xe3, 0x2f, 0x00, 0xd8, 0x04, 0x8d, 0x00, 0x80, 0xb0, 0x00, 0x80, 0xb0, 0x00, 0x10,
+    0x16, 0x00, 0x10, 0xd6, 0x57, 0x3e, 0xfe, 0xff, 0xb5, 0x62, 0x63, 0xac, 0xfc, 0xda, 0x00, 0x9c,
+    0x08, 0xeb, 0xe3, 0xe0, 0xeb, 0xfb, 0xef, 0x44, 0x25, 0xf0, 0xf5, 0xf1, 0xb3, 0xa5, 0xf0, 0xea,
+    0xf9, 0xa2, 0x32, 0x22, 0x2c, 0x60, 0xd3, 0x11, 0xd6, 0x91, 0xa0, 0xa2, 0x02, 0x38, 0x7b, 0xfc,
+    0x15, 0xa3, 0xa5, 0x8a, 0x88, 0x08, 0x0b, 0xb8, 0x89, 0xb0, 0x46, 0xfd, 0xfc, 0x4c, 0x5c, 0xaf,
+    0x64, 0xf8, 0xea, 0xff, 0x5b, 0xd3, 0xb8, 0x88, 0xb0, 0x8e, 0x9e, 0xeb, 0xd5, 0xdf, 0x36, 0x5d,
+    0x04, 0x36, 0x10, 0xd6, 0xd9, 0x68, 0x2a, 0x23, 0x85, 0xa3, 0xef, 0x1d, 0xc9, 0xe2, 0xec, 0x67,
+    0x67, 0x8f, 0x39, 0x9b, 0xd2, 0x56, 0x46, 0x7f, 0x67, 0x42, 0x03, 0xb0, 0xf1, 0x08, 0xeb, 0xec,
+    0xf7, 0x2b, 0xf2, 0x79, 0xf5, 0xb3, 0xa3, 0xff, 0x66, 0x5f, 0xdb, 0x91, 0xd0, 0xa2, 0x62, 0x03,
+    0x70, 0xb3, 0x29, 0x61, 0x64, 0x2a, 0xf8, 0x4e, 0x61, 0x8d, 0x7c, 0x1c, 0x80, 0xcd, 0x47, 0x58,
+    0x91, 0x69, 0x57, 0x54, 0x58, 0x3d, 0x23, 0xba, 0xea, 0x6b, 0x23, 0x2c, 0x60, 0xc3, 0x6d, 0x0d,
+    0xd1, 0xf5, 0xa1, 0xd6, 0xb4, 0xeb, 0x6c, 0xcb, 0x41, 0xf4, 0x79, 0xa3, 0xa3, 0xa4, 0xc8, 0xb6,
+    0x86, 0xc8, 0xef, 0xb5, 0xd6, 0xf1, 0x00, 0xd8, 0xe9, 0xbe, 0xd4, 0x66, 0x52, 0xed, 0x00, 0x10,
+    0x16, 0x61, 0x01, 0x20, 0xac, 0x59, 0x3b, 0xe6, 0x01, 0x10, 0x16, 0x00, 0x10, 0x16, 0x00, 0xc2,
+    0x02, 0x00, 0xc2, 0x02, 0x00, 0xc2, 0x02, 0x40, 0x58, 0x00, 0x40, 0x58, 0x00, 0x40, 0x58, 0x00,
+    0x08, 0x0b, 0x00, 0x08, 0x0b, 0x00, 0x08, 0x0b, 0x00, 0x61, 0x01, 0x00, 0x61, 0x01, 0x00, 0x61,
+    0x01, 0x20, 0x2c, 0x00, 0x20, 0x2c, 0x3c, 0x83, 0x11, 0x19, 0x64, 0xb2, 0xcc, 0x08, 0x0b, 0x13,
+    0x4e, 0xcc, 0x68, 0xa6, 0x3d, 0x61, 0xe5, 0x1f, 0xe3, 0x9e, 0x92, 0x84, 0x85, 0x0b, 0xa4, 0xa5,
+    0x4d, 0x08, 0x0b, 0x84, 0xb5, 0xa5, 0xb0, 0xce, 0xee, 0xe6, 0x73, 0x76, 0xa2, 0xee, 0x3c, 0x52,
+    0x1b, 0x71, 0xcf, 0xcb, 0xef, 0xdf, 0x37, 0x7a, 0x25, 0x2c, 0x0c, 0x3c, 0x39, 0x5b, 0xf7, 0x6d,
+    0x7c, 0xf5, 0xb3, 0xca, 0x63, 0x9e, 0x28, 0xac, 0xd6, 0xcf, 0x40, 0x58, 0xb8, 0x40, 0x58, 0x67,
+    0x22, 0x3b, 0x1a, 0x99, 0x11, 0x16, 0x61, 0x11, 0x16, 0x86, 0x9c, 0x9c, 0x91, 0xe9, 0x61, 0xe6,
+    0xdf, 0x4f, 0x58, 0xc3, 0x8a, 0x0a, 0x9a, 0xa0, 0x08, 0x0b, 0x1b, 0x08, 0xeb, 0xee, 0x23, 0xac,
+    0x6c, 0x1b, 0x9d, 0xad, 0xfd, 0x81, 0xb0, 0x10, 0x1c, 0x1d, 0x54, 0x16, 0xdd, 0xbf, 0x2f, 0x2a,
+    0xb7, 0x16, 0xdd, 0xef, 0x26, 0xac, 0xa3, 0x76, 0x30, 0xe2, 0x22, 0x2c, 0x60, 0xab, 0x8d, 0xa3,
+    0x20, 0x2c, 0x80, 0xb0, 0x40, 0x58, 0x3d, 0xfc, 0xfd, 0xf3, 0x67, 0xb3, 0x73, 0xff, 0xfb, 0x8f,
+    0x3f, 0x3e, 0x5e, 0xfd, 0xde, 0xd1, 0xf7, 0x41, 0x58, 0x20, 0xac, 0x29, 0xb2, 0x8a, 0x48, 0x87,
+    0xb0, 0x08, 0x0b, 0x84, 0xb5, 0x9d, 0xb0, 0xfe, 0xf9, 0x2f, 0x61, 0x11, 0x16, 0x08, 0xeb, 0x6d,
+    0xb2, 0xfa, 0xe4, 0x4c, 0x3c, 0x9f, 0x3f, 0xff, 0x2e, 0x2d, 0xc2, 0x22, 0x2c, 0x10, 0xd6, 0xb2,
+    0xc2, 0xfa, 0xfa, 0xb8, 0x15, 0x84, 0xf5, 0xe1, 0xcb, 0xd7, 0x46, 0x5f, 0x84, 0x35, 0x48, 0x56,
+    0x2d, 0x69, 0x7d, 0xff, 0xd9, 0xd7, 0xc7, 0x1b, 0x61, 0x19, 0x61, 0xc1, 0x08, 0x6b, 0x69, 0x61,
+    0x65, 0xd6, 0xbf, 0x40, 0x58, 0x20, 0xac, 0xe1, 0xb2, 0x3a, 0x93, 0x96, 0x4f, 0x09, 0x09, 0x0b,
+    0x84, 0x45, 0x58, 0x20, 0x2c, 0x10, 0xd6, 0x99, 0xac, 0xa2, 0x38, 0xb8, 0x84, 0x05, 0xc2, 0x02,
+    0x08, 0x0b, 0x84, 0x75, 0xc6, 0xef, 0xdf, 0xbf, 0x3f, 0xae, 0x7c, 0x1c, 0x08, 0x0b, 0x84, 0x55,
+    0x12, 0xce, 0x27, 0xef, 0x78, 0x3c, 0x08, 0xeb, 0x1d, 0x7b, 0x90, 0xce, 0xa2, 0x83, 0x08, 0x6b,
+    0x61, 0x51, 0x7d, 0x7e, 0xf5, 0x08, 0xeb, 0xeb, 0xdf, 0x58, 0x4d, 0x5c, 0x67, 0xb9, 0x55, 0xbb,
+    0x75, 0xd4, 0x91, 0xaf, 0xb5, 0x92, 0x87, 0x35, 0x73, 0x93, 0x63, 0x35, 0x01, 0xf5, 0xd5, 0xe3,
+    0xa3, 0xaf, 0x51, 0x76, 0xd7, 0x06, 0xc2, 0xfa, 0x2e, 0xaa, 0x91, 0xc2, 0x5a, 0x55, 0x5c, 0x67,
+    0xc2, 0x7a, 0xea, 0xa8, 0x28, 0x23, 0xac, 0x2b, 0x4e, 0xf0, 0x6a, 0xc6, 0x7c, 0xf4, 0xff, 0x09,
+    0x6b, 0x33, 0x61, 0x1d, 0x89, 0x6a, 0x86, 0xb0, 0x56, 0x13, 0xd7, 0x51, 0x74, 0x6f, 0x34, 0x41,
+    0x34, 0x93, 0x3a, 0x1a, 0xbd, 0xd3, 0xce, 0xab, 0xc7, 0x9f, 0xdd, 0x5a, 0x6c, 0xf4, 0xe8, 0x66,
+    0xe4, 0x7d, 0x09, 0x5b, 0x23, 0xd8, 0xb3, 0x1b, 0x78, 0x54, 0x47, 0x48, 0x19, 0x61, 0x1d, 0xfd,
+    0x2d, 0xc2, 0x5a, 0x54, 0x58, 0x67, 0x52, 0x99, 0x29, 0xac, 0xde, 0xbf, 0x7d, 0x95, 0xb0, 0xa2,
+    0x9d, 0xbf, 0x7a, 0x7b, 0xb0, 0xcc, 0xe3, 0x5b, 0xd2, 0x7a, 0xe7, 0x68, 0xad, 0xb7, 0x9d, 0xa2,
+    0xef, 0x3f, 0xfa, 0x3a, 0xa3, 0x17, 0xa2, 0xe8, 0x31, 0x23, 0x2b, 0x23, 0xac, 0xa5, 0x46, 0x58,
+    0x47, 0xff, 0xae, 0x9e, 0x88, 0xd9, 0x5c, 0xf3, 0xc8, 0xe3, 0xaf, 0xba, 0x6d, 0xd6, 0xca, 0xc2,
+    0x8a, 0x8e, 0x26, 0xa3, 0x17, 0x20, 0xc2, 0xb2, 0x86, 0xb5, 0xdd, 0x1a, 0xd6, 0x0c, 0x61, 0xf5,
+    0xac, 0xfb, 0x44, 0x4e, 0xaa, 0xd5, 0x6e, 0x70, 0x31, 0x6a, 0x1a, 0x76, 0x36, 0x3d, 0xab, 0xdc,
+    0xcd, 0x27, 0x32, 0x62, 0x6e, 0xdd, 0x30, 0x84, 0xb0, 0x7c, 0x4a, 0xb8, 0xfc, 0x62, 0x75, 0x66,
+    0x1a, 0x92, 0x3d, 0x59, 0x47, 0x4c, 0x89, 0xa2, 0xd3, 0xa6, 0xd5, 0x84, 0x15, 0x1d, 0xe1, 0xf4,
+    0x4e, 0x09, 0x7b, 0x8e, 0x0b, 0x61, 0xd9, 0x87, 0xb5, 0xe4, 0x01, 0x8f, 0x6e, 0x6b, 0x68, 0x4d,
+    0x41, 0xa2, 0x0b, 0xce, 0xad, 0x85, 0xf4, 0xc8, 0xef, 0x9e, 0xed, 0x0f, 0xfa, 0xfe, 0xff, 0x7f,
+    0xfe, 0xfa, 0xf5, 0x31, 0x83, 0x9e, 0xed, 0x21, 0x95, 0x05, 0xf7, 0xcc, 0xb1, 0xc8, 0x0a, 0xeb,
+    0x68, 0xea, 0x7d, 0x36, 0xfd, 0x9c, 0xd5, 0xae, 0xd9, 0x76, 0x27, 0x2c, 0x3b, 0xdd, 0xf1, 0xa6,
+    0x91, 0x98, 0x5b, 0xd9, 0x1b, 0x61, 0x01, 0x84, 0x85, 0xe7, 0x0a, 0xeb, 0xeb, 0x14, 0xaf, 0x85,
+    0x83, 0xab, 0x34, 0xe7, 0x09, 0x15, 0x06, 0x84, 0xb5, 0x81, 0xb4, 0x56, 0xde, 0x57, 0x05, 0xc5,
+    0xcf, 0x20, 0x2c, 0xc2, 0x22, 0x2c, 0x60, 0xcf, 0x17, 0x7e, 0x24, 0x2d, 0xb2, 0x22, 0x2c, 0x10,
+    0x16, 0x61, 0x81, 0xb0, 0x40, 0x58, 0x23, 0xa5, 0x45, 0x56, 0x84, 0x05, 0xc2, 0x22, 0x2c, 0x10,
+    0x16, 0x08, 0x6b, 0xa4, 0xb4, 0xc8, 0x8a, 0xb0, 0x40, 0x58, 0x84, 0x05, 0xc2, 0x02, 0x61, 0xad,
+    0x50, 0xb6, 0x03, 0xc2, 0x02, 0x61, 0x01, 0x84, 0x05, 0xc2, 0x02, 0x61, 0x81, 0xb0, 0x34, 0x02,
+    0x08, 0x0b, 0x84, 0x05, 0x10, 0x16, 0x08, 0x0b, 0x84, 0x05, 0xc2, 0x02, 0x08, 0x0b, 0x84, 0x05,
+    0x10, 0x16, 0x08, 0x0b, 0x84, 0x05, 0xc2, 0x02, 0x08, 0x0b, 0x84, 0x05, 0x10, 0x16, 0x08, 0x0b,
+    0x84, 0x05, 0xc2, 0xc2, 0x1d, 0x45, 0xb0, 0x83, 0x0c, 0x46, 0xbc, 0xc6, 0xc8, 0x7b, 0xad, 0xb4,
+    0x87, 0x9b, 0x54, 0x3c, 0x58, 0x58, 0x3d, 0x37, 0xa9, 0xbc, 0x93, 0x40, 0x46, 0xbc, 0xef, 0xe8,
+    0x63, 0xa3, 0x37, 0xf3, 0xdc, 0x49, 0x58, 0x67, 0x37, 0x41, 0x9d, 0x21, 0xc7, 0xc8, 0x8d, 0x6b,
+    0xdd, 0x81, 0xe7, 0xa6, 0x23, 0xac, 0xa7, 0xdf, 0x0f, 0x6e, 0xd4, 0xfb, 0xaf, 0x0a, 0x6b, 0xc5,
+    0x63, 0x90, 0x79, 0xfe, 0xde, 0x5b, 0xbc, 0x8f, 0x12, 0x96, 0xbe, 0x4c, 0x58, 0x7f, 0x1d, 0x5d,
+    0xa9, 0xbe, 0x5f, 0xc9, 0x32, 0x57, 0xbe, 0x5d, 0x84, 0xd5, 0xba, 0x77, 0xde, 0xd1, 0xef, 0x9e,
+    0xdd, 0x4a, 0xbe, 0x2a, 0xac, 0xec, 0x7d, 0xfc, 0x32, 0xc7, 0x67, 0xb4, 0x7c, 0xcf, 0xe4, 0x75,
+    0xf4, 0x5a, 0x8f, 0xda, 0x2b, 0xd3, 0x86, 0xad, 0xf7, 0x1a, 0xe9, 0xc7, 0x91, 0xd7, 0x4b, 0x58,
+    0x0b, 0x4f, 0x8b, 0x5a, 0x57, 0xcf, 0x57, 0x07, 0x3b, 0xfa, 0xf8, 0x95, 0x85, 0x55, 0x95, 0x78,
+    0xf4, 0xc4, 0xe9, 0x19, 0xa5, 0x44, 0xef, 0x94, 0x1c, 0x39, 0x3e, 0x57, 0x09, 0x2b, 0xda, 0x8f,
+    0x8e, 0x1e, 0x13, 0xed, 0x47, 0x99, 0xb6, 0x89, 0x3e, 0x1f, 0x61, 0x6d, 0x34, 0xc2, 0x8a, 0xfe,
+    0xec, 0xec, 0xdf, 0xab, 0xad, 0xcf, 0x44, 0xd6, 0x5f, 0x32, 0x1d, 0x7e, 0xc4, 0x34, 0xe5, 0xac,
+    0x8d, 0x7a, 0x84, 0x35, 0x7b, 0x9a, 0xd6, 0x12, 0x79, 0x54, 0x58, 0xa3, 0xa6, 0xcc, 0x91, 0x91,
+    0x68, 0x44, 0x90, 0x44, 0xf5, 0x60, 0x61, 0xed, 0xf8, 0x89, 0xd8, 0x08, 0x61, 0x45, 0x05, 0x94,
+    0x3d, 0x81, 0xaf, 0x10, 0xd6, 0xa8, 0xb6, 0xeb, 0x15, 0x56, 0xa6, 0x0d, 0xab, 0xef, 0xf9, 0x6c,
+    0xe4, 0x49, 0x5a, 0x0f, 0x17, 0xd6, 0x0e, 0x53, 0xc2, 0x5e, 0x61, 0x65, 0xa6, 0xd5, 0xb3, 0xa7,
+    0x84, 0x57, 0x5c, 0x44, 0xb2, 0xd3, 0xad, 0xca, 0xfb, 0xab, 0x08, 0xab, 0xda, 0x56, 0xa6, 0x84,
+    0x9b, 0x6f, 0x6b, 0x88, 0x7c, 0xaf, 0xb2, 0x78, 0xf9, 0xe7, 0xaf, 0x5f, 0x1f, 0xef, 0x22, 0xb2,
+    0xb0, 0x9a, 0x5d, 0xe8, 0x3e, 0x5b, 0x84, 0xaf, 0xb6, 0x6f, 0xef, 0xa2, 0x7b, 0xe4, 0xf8, 0xf4,
+    0xb4, 0x5f, 0x6b, 0x5a, 0x1d, 0xd9, 0x66, 0x70, 0x36, 0x55, 0x8b, 0xb6, 0x61, 0xe4, 0xf9, 0x22,
+    0xc7, 0x6d, 0xe5, 0x3e, 0xfb, 0xaa, 0xdd, 0x6d, 0x1c, 0x05, 0xec, 0xec, 0x07, 0x61, 0x01, 0xeb,
+    0x8a, 0x8a, 0xb0, 0x08, 0x0b, 0x46, 0x1c, 0x4a, 0xa5, 0x08, 0x0b, 0x20, 0x2c, 0x10, 0x16, 0x40,
+    0x58, 0x20, 0x2c, 0x10, 0x16, 0x08, 0x0b, 0x20, 0x2c, 0x10, 0x96, 0x45, 0xcb, 0xbd, 0xdb, 0x69,
+    0xc4, 0x73, 0x39, 0xa6, 0x58, 0x7e, 0xe3, 0x68, 0xb5, 0xde, 0xef, 0x2e, 0x9d, 0x7b, 0x54, 0x68,
+    0x5d, 0x76, 0x47, 0x7d, 0x76, 0x73, 0xea, 0x15, 0xef, 0x25, 0x53, 0x4b, 0x38, 0xbb, 0x56, 0xb4,
+    0xa7, 0x6e, 0x90, 0x60, 0xe4, 0x61, 0x11, 0xd6, 0xa4, 0x13, 0x6f, 0xe4, 0x28, 0xe9, 0xca, 0x11,
+    0xd6, 0xec, 0xf2, 0xab, 0xd6, 0x45, 0x60, 0x74, 0xdb, 0x61, 0x33, 0x61, 0x45, 0xe2, 0x48, 0x56,
+    0x4f, 0x60, 0x18, 0xb1, 0x81, 0x30, 0x5b, 0x6e, 0x94, 0x29, 0x3b, 0x39, 0x7b, 0xee, 0xb3, 0xfa,
+    0xb7, 0x4a, 0xee, 0xd5, 0xc8, 0x80, 0xbc, 0x4a, 0x2d, 0x61, 0x74, 0x14, 0x14, 0x29, 0xcf, 0xa9,
+    0xb4, 0x5d, 0xa4, 0xdd, 0x08, 0x6e, 0xe3, 0x3c, 0xac, 0xcc, 0xc9, 0x70, 0x97, 0x11, 0x56, 0xab,
+    0x48, 0xb6, 0xb7, 0x20, 0x3c, 0x52, 0xb0, 0xdb, 0x3a, 0xe9, 0x32, 0x75, 0x6f, 0xbd, 0x3b, 0xb8,
+    0x47, 0x08, 0x2b, 0xd3, 0x96, 0xd5, 0xe2, 0xe3, 0x56, 0xdb, 0x45, 0xda, 0xcd, 0xba, 0xdd, 0x0d,
+    0x46, 0x58, 0xbb, 0x27, 0x30, 0xec, 0x28, 0xac, 0xe8, 0x89, 0x9a, 0xc9, 0xd7, 0xba, 0x6a, 0x4a,
+    0x98, 0x29, 0x5e, 0x6e, 0x49, 0x37, 0x23, 0x92, 0x4c, 0xdb, 0x55, 0x12, 0x38, 0x40, 0x58, 0xcb,
+    0x7e, 0x82, 0x17, 0x1d, 0xa9, 0xbc, 0x4b, 0x58, 0x95, 0x7c, 0xad, 0x2b, 0x8e, 0x4d, 0x75, 0x2a,
+    0x5a, 0x91, 0x52, 0xe5, 0xb9, 0xb3, 0xc1, 0x88, 0xd8, 0x74, 0xd1, 0x3d, 0xd3, 0x19, 0xee, 0xb4,
+    0xd8, 0x3e, 0x2a, 0x3b, 0x29, 0xda, 0x4e, 0x33, 0x2e, 0x18, 0x57, 0x4e, 0x75, 0xae, 0x9a, 0x12,
+    0x56, 0x52, 0x5e, 0x2b, 0xc1, 0x88, 0xd8, 0x70, 0x5b, 0x43, 0xeb, 0x86, 0x0a, 0xa3, 0xf3, 0x95,
+    0x56, 0xc9, 0xc3, 0x8a, 0x4e, 0x49, 0x2a, 0xb9, 0x56, 0x23, 0xf2, 0xac, 0x2a, 0xf9, 0x5a, 0x33,
+    0x8e, 0x4f, 0xf6, 0x3d, 0xf7, 0x64, 0x7b, 0xf5, 0x6c, 0x09, 0x69, 0x8d, 0x9e, 0x57, 0xcd, 0xbd,
+    0x92, 0x87, 0x05, 0xc0, 0xe6, 0x58, 0xc2, 0x02, 0x08, 0x8b, 0xb0, 0x00, 0x27, 0xf3, 0x25, 0x4b,
+    0x21, 0x8e, 0x37, 0x61, 0x81, 0xb0, 0x40, 0x58, 0x00, 0x61, 0x81, 0xb0, 0x00, 0xc2, 0x02, 0x61,
+    0x81, 0xb0, 0x40, 0x58, 0x58, 0x7c, 0x31, 0x97, 0xb0, 0x1c, 0x6b, 0xc2, 0xba, 0xb8, 0x2c, 0x25,
+    0x5a, 0x2d, 0x1f, 0xbd, 0x59, 0xe5, 0x4e, 0x9f, 0x16, 0xf5, 0xbc, 0x8f, 0x59, 0xef, 0xfd, 0xca,
+    0x36, 0xad, 0xe4, 0x61, 0xed, 0x5e, 0x92, 0x45, 0xec, 0x37, 0x2a, 0xcd, 0xe9, 0x2d, 0xc6, 0xdd,
+    0xed, 0x4a, 0xb9, 0x52, 0x27, 0x7e, 0x87, 0x14, 0x7a, 0xd2, 0x1a, 0xee, 0x50, 0x8e, 0x45, 0x58,
+    0x9b, 0x09, 0x6b, 0x74, 0x1e, 0xd2, 0xca, 0x43, 0xe8, 0x51, 0x99, 0x4a, 0x95, 0x22, 0xdc, 0x56,
+    0xee, 0xd8, 0xea, 0x23, 0xac, 0xef, 0xed, 0x15, 0xcd, 0x50, 0x6b, 0xb5, 0x5f, 0xe6, 0x22, 0x92,
+    0x29, 0xff, 0x89, 0x16, 0x54, 0x47, 0xb2, 0xce, 0xa2, 0xaf, 0x9b, 0xb0, 0x36, 0x12, 0xd6, 0x51,
+    0x1d, 0xe2, 0x4e, 0xc2, 0x1a, 0x91, 0x45, 0x55, 0x09, 0xb9, 0xdb, 0x4d, 0x58, 0x23, 0x24, 0xde,
+    0x5b, 0x88, 0x9f, 0x9d, 0x19, 0x64, 0x8b, 0xae, 0x7b, 0x67, 0x23, 0x84, 0x35, 0x69, 0x2e, 0xdf,
+    0x53, 0x98, 0xba, 0x5b, 0x55, 0xfc, 0xc8, 0x4c, 0xa5, 0x48, 0x91, 0x73, 0x55, 0xe0, 0xbb, 0x08,
+    0x2b, 0x93, 0x18, 0x91, 0x69, 0xa7, 0xec, 0x05, 0xb2, 0x72, 0x21, 0xc8, 0x5e, 0x34, 0x5a, 0xc5,
+    0xe9, 0x84, 0x75, 0x51, 0xe7, 0xac, 0x44, 0x79, 0xdc, 0x59, 0x58, 0xbd, 0x59, 0x54, 0xd5, 0xbc,
+    0xa7, 0x1d, 0xae, 0xda, 0xa3, 0x85, 0x55, 0x59, 0xcb, 0x1b, 0x15, 0x09, 0x5d, 0xb9, 0xe1, 0xc5,
+    0xc3, 0xd6, 0xb2, 0xd6, 0xfd, 0x08, 0x7b, 0xd4, 0xa2, 0xfb, 0x4e, 0xc2, 0xca, 0x8a, 0x27, 0x7a,
+    0xf2, 0x54, 0x23, 0x80, 0xef, 0x28, 0xac, 0x4a, 0x46, 0xd5, 0xe8, 0x29, 0x61, 0x35, 0xab, 0xcb,
+    0x94, 0x70, 0xf1, 0x22, 0xd0, 0xe8, 0x30, 0x37, 0xba, 0xf5, 0x61, 0x95, 0xdc, 0xa1, 0xcc, 0xb6,
+    0x86, 0x51, 0x59, 0x54, 0x95, 0xc5, 0xe1, 0xd6, 0x74, 0x63, 0xa5, 0xf6, 0xcb, 0x64, 0xa8, 0x65,
+    0xb7, 0x94, 0x64, 0x8e, 0x41, 0x6f, 0xbf, 0xae, 0x3e, 0xf7, 0x15, 0x7d, 0xdc, 0x08, 0xcb, 0x26,
+    0x44, 0x00, 0x84, 0x45, 0x58, 0x00, 0x61, 0x6d, 0xbc, 0x9b, 0xd8, 0xc1, 0x76, 0x91, 0x01, 0x61,
+    0x01, 0x84, 0x05, 0xc2, 0x02, 0x61, 0x01, 0x84, 0x05, 0xc2, 0x02, 0x61, 0x01, 0x84, 0x05, 0xc2,
+    0x42, 0x57, 0xf2, 0x03, 0x61, 0x39, 0xee, 0x84, 0x35, 0xa9, 0x8e, 0xb0, 0x27, 0x0f, 0x6b, 0xc7,
+    0x83, 0xb6, 0x4b, 0x1e, 0xd6, 0xd5, 0xed, 0x5b, 0xc9, 0xc3, 0xda, 0xf9, 0xa4, 0x95, 0x8d, 0x25,
+    0x0f, 0x6b, 0xeb, 0xab, 0xe3, 0x6a, 0x79, 0x58, 0x57, 0xb7, 0xef, 0xc8, 0xb4, 0x8e, 0xdd, 0x46,
+    0x93, 0x84, 0xf5, 0xb0, 0x78, 0x99, 0x4c, 0xe1, 0x70, 0xa4, 0xd8, 0x78, 0x76, 0x81, 0xe9, 0x2e,
+    0x79, 0x58, 0xbb, 0x08, 0xeb, 0x28, 0xc5, 0x20, 0x5a, 0x7e, 0x93, 0x6d, 0xb7, 0x4c, 0x59, 0x4f,
+    0xf6, 0xbd, 0xca, 0xc6, 0x7a, 0x98, 0xb0, 0x32, 0x85, 0xd0, 0xad, 0x13, 0x7d, 0xe6, 0x74, 0x2b,
+    0x23, 0xae, 0x48, 0x87, 0xce, 0x14, 0xf9, 0x66, 0x3a, 0xf7, 0x6a, 0x53, 0xc2, 0xb3, 0xe3, 0x9f,
+    0x2d, 0x64, 0x3e, 0xaa, 0xcf, 0xcb, 0x5c, 0xe4, 0x7a, 0x66, 0x09, 0xb2, 0xb1, 0x1e, 0x9a, 0x87,
+    0x55, 0x11, 0x56, 0x54, 0x12, 0x33, 0x85, 0x15, 0x79, 0x2e, 0x79, 0x58, 0x39, 0x61, 0x65, 0x47,
+    0xca, 0xd9, 0x6c, 0x2b, 0xd9, 0x58, 0x46, 0x58, 0xa9, 0xef, 0x3d, 0x45, 0x58, 0xef, 0xce, 0xc3,
+    0x5a, 0xb9, 0xd3, 0x47, 0xa5, 0x5d, 0x69, 0x8b, 0x6c, 0x3e, 0xd5, 0x88, 0xfe, 0x22, 0x1b, 0xeb,
+    0xc1, 0x79, 0x58, 0x3d, 0xd9, 0x44, 0xef, 0x10, 0x56, 0x65, 0x0a, 0x13, 0x39, 0x61, 0x7a, 0xde,
+    0xd3, 0x6e, 0x79, 0x62, 0xd5, 0xb8, 0xe3, 0xcc, 0x88, 0x69, 0xe4, 0x94, 0x50, 0x36, 0xd6, 0x83,
+    0xf2, 0xb0, 0xa2, 0x91, 0xb6, 0x99, 0x2b, 0x6e, 0x34, 0x5f, 0xea, 0x1f, 0xe4, 0x61, 0xad, 0x97,
+    0x87, 0x95, 0xd9, 0x36, 0x52, 0xd9, 0x62, 0xf2, 0xe4, 0x6c, 0x2c, 0x23, 0x2c, 0x00, 0x20, 0x2c,
+    0x00, 0x84, 0x05, 0x28, 0xcd, 0x01, 0x61, 0x01, 0x84, 0x05, 0xc2, 0x02, 0x61, 0x81, 0xb0, 0x00,
+    0xc2, 0x02, 0x61, 0x01, 0x84, 0x05, 0xc2, 0xc2, 0x3e, 0x79, 0x4a, 0x33, 0x23, 0x72, 0x46, 0xbd,
+    0x7f, 0x37, 0x37, 0xb1, 0x71, 0xf4, 0x71, 0x57, 0xee, 0xca, 0x46, 0xce, 0x9e, 0x9d, 0xf3, 0x99,
+    0xba, 0xb8, 0xdd, 0x84, 0xd5, 0x5b, 0x62, 0x54, 0xd9, 0x98, 0x4c, 0x58, 0x4a, 0x73, 0x1e, 0x37,
+    0xd5, 0xa8, 0x16, 0x23, 0x8f, 0x38, 0x29, 0x67, 0x97, 0x1d, 0xed, 0x2e, 0xac, 0x9d, 0xda, 0x8c,
+    0xb0, 0xde, 0xd0, 0x39, 0x5b, 0x55, 0xf5, 0xd1, 0xf2, 0x92, 0x57, 0x7f, 0x67, 0xd5, 0x0a, 0xf6,
+    0x96, 0xb0, 0x22, 0xef, 0x2f, 0xfa, 0x1e, 0xb3, 0x75, 0x97, 0xad, 0x0c, 0xae, 0x19, 0x79, 0x5b,
+    0x15, 0x11, 0x44, 0xfb, 0x4c, 0x36, 0xd1, 0x76, 0xa7, 0x36, 0x23, 0xac, 0x37, 0x16, 0xaf, 0x46,
+    0x53, 0x13, 0xb2, 0x39, 0x4f, 0xab, 0x8e, 0xb0, 0x2a, 0xc5, 0xb9, 0x95, 0x62, 0xd7, 0x6a, 0x1e,
+    0x58, 0x4f, 0x11, 0x71, 0xe5, 0x22, 0x31, 0x4a, 0x58, 0xbd, 0x85, 0xf1, 0x3b, 0xb5, 0x19, 0x61,
+    0xbd, 0xb9, 0xda, 0x3e, 0x53, 0x3d, 0x1f, 0x95, 0xd3, 0x8e, 0xc2, 0xca, 0xae, 0xa1, 0x64, 0x0a,
+    0x99, 0x7b, 0x4e, 0xd8, 0xe8, 0xeb, 0xbc, 0x22, 0x97, 0x7e, 0xb6, 0xb0, 0x76, 0x68, 0x33, 0xc2,
+    0x5a, 0x50, 0x58, 0x99, 0x35, 0x84, 0xdd, 0x84, 0x55, 0x59, 0xcf, 0xaa, 0x08, 0x2b, 0x3b, 0xd2,
+    0xad, 0x8c, 0x16, 0xae, 0x6c, 0xf3, 0xcc, 0x89, 0x3f, 0x62, 0x84, 0x75, 0x87, 0x36, 0x23, 0xac,
+    0x0b, 0x84, 0x35, 0x22, 0xe7, 0x69, 0x77, 0x61, 0x8d, 0x9e, 0x12, 0x66, 0xdb, 0x3d, 0x33, 0xf2,
+    0xbd, 0x52, 0x58, 0xd1, 0xf7, 0x11, 0xfd, 0xd9, 0xdd, 0xdb, 0x8c, 0xb0, 0x06, 0x6d, 0x6b, 0xc8,
+    0xe6, 0x39, 0x65, 0x16, 0xe2, 0xcf, 0x3a, 0xe7, 0x0a, 0x79, 0x4e, 0x23, 0x16, 0xdd, 0x23, 0x8b,
+    0xbf, 0x91, 0x0f, 0x33, 0xaa, 0x53, 0xd1, 0xcc, 0x71, 0x98, 0xd1, 0x7e, 0xd9, 0xb6, 0x8a, 0xb6,
+    0xe3, 0x1d, 0xda, 0x6c, 0x64, 0xbf, 0xb5, 0x71, 0x14, 0x76, 0xa2, 0x6b, 0x33, 0x10, 0x16, 0x66,
+    0x7e, 0x40, 0x00, 0x6d, 0x46, 0x58, 0x78, 0x7c, 0x09, 0xcf, 0x9d, 0x4e, 0x6e, 0xdb, 0x13, 0x08,
+    0x0b, 0xa6, 0x4f, 0x20, 0x2c, 0x80, 0xb0, 0x40, 0x58, 0x00, 0x61, 0x81, 0xb0, 0x40, 0x58, 0x20,
+    0x2c, 0x0b, 0x99, 0x20, 0x2c, 0x7d, 0x9a, 0xb0, 0x32, 0x65, 0x15, 0xa3, 0x3a, 0xb5, 0x4e, 0x70,
+    0x5f, 0x61, 0xf5, 0xf4, 0x9f, 0x15, 0xfb, 0xbb, 0xbe, 0xba, 0x79, 0x69, 0x0e, 0x61, 0x11, 0xd6,
+    0xac, 0xfe, 0xb3, 0x4b, 0xed, 0x2c, 0x16, 0x17, 0x56, 0x34, 0x6a, 0x23, 0x5b, 0xa2, 0x23, 0xbe,
+    0xe3, 0x99, 0xc2, 0xca, 0x64, 0x4e, 0x65, 0xcb, 0x67, 0xce, 0xca, 0x7d, 0xe4, 0x6b, 0x3d, 0x50,
+    0x58, 0x95, 0xc2, 0xe8, 0x6c, 0x55, 0x3e, 0x69, 0xdd, 0x57, 0x58, 0x91, 0xcc, 0xa9, 0x8c, 0xc0,
+    0x5a, 0xc5, 0xe7, 0x95, 0xf8, 0x1f, 0xf9, 0x5a, 0x37, 0x13, 0x56, 0x24, 0x3a, 0x24, 0x1b, 0x31,
+    0xb2, 0xd3, 0xba, 0x07, 0x61, 0xe5, 0xd6, 0x85, 0xa2, 0xc7, 0xba, 0x47, 0x14, 0x67, 0xd2, 0x88,
+    0xa4, 0xbe, 0xca, 0xd7, 0x7a, 0xc8, 0x08, 0xab, 0x32, 0xf7, 0x37, 0xa2, 0x7a, 0x8e, 0xdc, 0xaa,
+    0x51, 0x3b, 0x23, 0x85, 0xd5, 0x23, 0x63, 0xf9, 0x5a, 0x9b, 0x2f, 0xba, 0x9b, 0x12, 0xe2, 0xea,
+    0xfe, 0xd3, 0xd3, 0x77, 0x46, 0x24, 0xc2, 0x46, 0x2f, 0xc8, 0x0f, 0xcd, 0xd7, 0x5a, 0x7f, 0x5b,
+    0x43, 0xf6, 0xc6, 0x13, 0x91, 0x0c, 0xac, 0x95, 0x33, 0x87, 0xd0, 0x9f, 0x27, 0x96, 0xed, 0x2b,
+    0xd5, 0x45, 0xf4, 0x68, 0x7f, 0xad, 0xfc, 0x6c, 0xc5, 0x7c, 0x2d, 0x23, 0x2c, 0x00, 0x36, 0xd7,
+    0x12, 0x16, 0x70, 0x6f, 0x51, 0x11, 0x16, 0x60, 0xf4, 0xa0, 0x84, 0x87, 0xb0, 0x00, 0xc2, 0x02,
+    0x61, 0x81, 0xb0, 0x40, 0x58, 0x00, 0x61, 0x81, 0xb0, 0x00, 0xc2, 0x02, 0x61, 0x81, 0xb0, 0x40,
+    0x58, 0x00, 0x40, 0x58, 0x00, 0x40, 0x58, 0x00, 0x08, 0x0b, 0x00, 0x08, 0x0b, 0x00, 0x08, 0x0b,
+    0x00, 0x61, 0x4d, 0xaa, 0x8b, 0x8a, 0x06, 0x97, 0xad, 0xf4, 0xb1, 0x7a, 0x36, 0xb5, 0xf4, 0x2c,
+    0x4d, 0xf2, 0xe8, 0xeb, 0xa9, 0x5b, 0x08, 0x56, 0xec, 0x17, 0x91, 0xe7, 0xbe, 0xc3, 0x5d, 0x7c,
+    0x16, 0xef, 0x7b, 0x6b, 0x16, 0x73, 0xae, 0xdc, 0x29, 0x5f, 0x35, 0x74, 0xaf, 0xb0, 0x5a, 0xff,
+    0x7e, 0xe2, 0x9e, 0xa7, 0xd5, 0xfa, 0x45, 0xb4, 0xcd, 0x76, 0x0a, 0x88, 0xdc, 0xb0, 0xef, 0xad,
+    0xd3, 0x68, 0x47, 0xff, 0x3d, 0x93, 0xc9, 0x51, 0xe0, 0x59, 0xe4, 0x31, 0x3d, 0x91, 0xb2, 0xd1,
+    0xab, 0x6c, 0x76, 0x34, 0xd6, 0x1a, 0x85, 0x1d, 0x7d, 0xaf, 0x7a, 0xa7, 0xa0, 0x95, 0x47, 0x03,
+    0x2b, 0xf6, 0x8b, 0x11, 0xc2, 0x5a, 0xed, 0x2e, 0x3e, 0x9b, 0xf5, 0xbd, 0x3d, 0x3a, 0xe6, 0xa8,
+    0xa8, 0xdb, 0xde, 0xd0, 0xff, 0xc8, 0x81, 0x8c, 0xbc, 0xce, 0x4c, 0xa7, 0x89, 0xde, 0x50, 0x23,
+    0x73, 0xc5, 0xdc, 0x21, 0x3e, 0x77, 0xc5, 0x7e, 0x11, 0x15, 0x4a, 0xe6, 0xf8, 0xb5, 0xa4, 0x33,
+    0xfb, 0x2e, 0x3e, 0x9b, 0xf5, 0xbd, 0x3d, 0x86, 0xa5, 0x23, 0xb2, 0xdd, 0x33, 0x6b, 0x0c, 0x3d,
+    0x1d, 0xb8, 0xe7, 0xce, 0x25, 0xbd, 0x53, 0xd1, 0x11, 0x77, 0x15, 0xda, 0x69, 0xba, 0xb2, 0x62,
+    0xbf, 0xd8, 0xed, 0x2e, 0x3e, 0x9b, 0xf5, 0xbd, 0x7b, 0x77, 0xcc, 0xaa, 0xd1, 0xb3, 0x0d, 0x99,
+    0xbd, 0xcb, 0x4f, 0xcf, 0xc2, 0xfc, 0x88, 0x91, 0xdf, 0x2e, 0x6b, 0x58, 0x2b, 0xf5, 0x8b, 0x4a,
+    0xdf, 0xd9, 0xe1, 0x2e, 0x3e, 0x9b, 0xf5, 0xbd, 0x75, 0x0b, 0x5d, 0x2b, 0x07, 0xea, 0xaa, 0x29,
+    0x61, 0xe4, 0xb6, 0x4b, 0x57, 0x4d, 0x09, 0x7b, 0xdf, 0xcf, 0x0e, 0xc2, 0x7a, 0x77, 0xbf, 0x88,
+    0x1e, 0xef, 0xde, 0x29, 0xe1, 0x88, 0x91, 0xe2, 0xa8, 0x0f, 0x0b, 0x16, 0xed, 0x7b, 0xfb, 0x7c,
+    0x7c, 0x1d, 0xb9, 0x7b, 0x49, 0x6b, 0xb1, 0x35, 0xf2, 0x77, 0x5e, 0x0d, 0x5f, 0x5b, 0x43, 0xfb,
+    0xec, 0xdf, 0xaf, 0xb6, 0x45, 0x66, 0x31, 0x79, 0xd4, 0xeb, 0xd2, 0x2f, 0x6a, 0xfd, 0xe2, 0xa8,
+    0x6d, 0x57, 0xba, 0x8b, 0xcf, 0x86, 0x7d, 0xcf, 0x66, 0xb4, 0x3b, 0xc7, 0xb2, 0x88, 0x69, 0xc1,
+    0xcd, 0xfa, 0x9e, 0x86, 0xd6, 0x69, 0x00, 0xc2, 0xc2, 0x62, 0xd3, 0x29, 0xe0, 0x06, 0x7d, 0x4f,
+    0x23, 0x03, 0x50, 0x4b, 0x08, 0x00, 0x84, 0x05, 0x80, 0xb0, 0x00, 0x80, 0xb0, 0x76, 0x48, 0x01,
+    0xf0, 0x7a, 0x00, 0xc2, 0x2a, 0xe7, 0xf1, 0x54, 0x37, 0xbd, 0x45, 0x6b, 0x96, 0xb2, 0x25, 0x0b,
+    0xb3, 0x53, 0x0d, 0x08, 0xeb, 0xba, 0x7e, 0xb1, 0xda, 0x7b, 0xda, 0xa1, 0xea, 0x80, 0xb0, 0x3a,
+    0xcb, 0x5c, 0x7a, 0x33, 0x7d, 0xaa, 0xb5, 0x82, 0xb3, 0x3a, 0x96, 0x8e, 0x3a, 0xbe, 0x5f, 0xac,
+    0xb6, 0x2f, 0xed, 0xdd, 0xd9, 0x53, 0x84, 0x75, 0xf1, 0xc9, 0xda, 0x53, 0x8b, 0x57, 0xc9, 0x28,
+    0xca, 0xd6, 0x68, 0x45, 0x33, 0x8e, 0xaa, 0xa5, 0x0c, 0x91, 0x0c, 0xa2, 0xe8, 0x73, 0xef, 0x28,
+    0xac, 0xca, 0xef, 0x45, 0x32, 0x9e, 0xce, 0xca, 0x68, 0x32, 0x51, 0x2f, 0x99, 0x7d, 0x48, 0x91,
+    0x7e, 0x3a, 0xe2, 0x79, 0x6f, 0xb8, 0x27, 0x6f, 0xbd, 0xe1, 0x7f, 0xb6, 0xe0, 0x75, 0x74, 0x01,
+    0xe6, 0xcc, 0x8c, 0xa3, 0x51, 0x7f, 0x2f, 0x5a, 0x6c, 0xbd, 0x73, 0x67, 0x6d, 0xf5, 0x8b, 0xc8,
+    0x74, 0x2a, 0x73, 0x51, 0x88, 0x64, 0x3f, 0x55, 0x8f, 0x69, 0x4f, 0x3f, 0xad, 0x3e, 0xef, 0x4d,
+    0x47, 0x71, 0xeb, 0x5f, 0x49, 0x67, 0x75, 0x84, 0xcc, 0x1a, 0xd5, 0xcc, 0x8c, 0xa3, 0xcc, 0xeb,
+    0xa9, 0x3e, 0xf7, 0x13, 0x46, 0x58, 0xd1, 0x62, 0xe0, 0xde, 0xa9, 0x64, 0x25, 0xf7, 0x69, 0xf4,
+    0x85, 0x75, 0xf7, 0xac, 0xb3, 0xdb, 0x0a, 0xab, 0x77, 0xad, 0x69, 0x54, 0xc4, 0xc5, 0xcc, 0x8c,
+    0xa3, 0x9e, 0x11, 0xe4, 0x8e, 0x39, 0x57, 0x2b, 0x4c, 0x09, 0x2b, 0x53, 0xab, 0x91, 0x6b, 0x51,
+    0xa3, 0x85, 0xf5, 0xa0, 0xf5, 0xd1, 0x3d, 0x72, 0x8f, 0x5a, 0x57, 0xd2, 0x95, 0xa7, 0x84, 0xd1,
+    0x2b, 0xe4, 0x88, 0xd7, 0xfa, 0x84, 0x11, 0x56, 0x4f, 0x36, 0xd5, 0x55, 0xc7, 0x74, 0x76, 0x3f,
+    0x35, 0x25, 0x5c, 0xb0, 0x58, 0x32, 0x9a, 0x41, 0x94, 0x5d, 0x78, 0xac, 0x64, 0x2a, 0x8d, 0xce,
+    0x38, 0x3a, 0x5b, 0x9f, 0xc8, 0xbe, 0xc6, 0xde, 0x1b, 0x2a, 0xec, 0x58, 0x44, 0x9b, 0x9d, 0x2e,
+    0x67, 0x8e, 0x69, 0xab, 0xbf, 0xf4, 0xde, 0xf0, 0xa1, 0xda, 0x4f, 0x47, 0xf5, 0x17, 0xc2, 0x02,
+    0x00, 0xc2, 0x02, 0x00, 0xc2, 0x02, 0x40, 0x58, 0x00, 0x40, 0x58, 0x00, 0x40, 0x58, 0x00, 0x08,
+    0x0b, 0x00, 0x08, 0x6b, 0xa5, 0x3d, 0x42, 0xda, 0x02, 0x78, 0xf0, 0xc6, 0xd1, 0xec, 0x0d, 0x22,
+    0xab, 0x95, 0xf2, 0x57, 0x96, 0x8d, 0x00, 0xb8, 0x79, 0x69, 0xce, 0x59, 0xc5, 0xfa, 0x88, 0x1a,
+    0x3b, 0xc2, 0x02, 0x08, 0x6b, 0x6a, 0xf1, 0x73, 0x4f, 0x5d, 0x56, 0xb5, 0xa4, 0xa1, 0x55, 0x15,
+    0x1f, 0xfd, 0xfd, 0x33, 0xf9, 0xb6, 0x7e, 0x1f, 0xc0, 0x82, 0xc2, 0x1a, 0x15, 0xcd, 0xd2, 0x2a,
+    0x1c, 0x9d, 0x91, 0x3b, 0xd5, 0xfa, 0xfd, 0x4a, 0x41, 0x2b, 0x80, 0x0d, 0xd3, 0x1a, 0x22, 0xc5,
+    0xcf, 0x3d, 0xc2, 0xaa, 0x66, 0xc0, 0x8f, 0x88, 0xe9, 0x3d, 0xfa, 0x2f, 0x80, 0x4d, 0xa7, 0x84,
+    0x15, 0x21, 0x54, 0x47, 0x58, 0x3d, 0x82, 0xaa, 0x64, 0x2b, 0x11, 0x16, 0xf0, 0x00, 0x61, 0x65,
+    0xf3, 0xaa, 0x2a, 0xd2, 0x89, 0xc6, 0x1e, 0x57, 0xfe, 0xd6, 0x3b, 0x3e, 0x24, 0x00, 0x08, 0x6b,
+    0xf0, 0xfa, 0x55, 0xf4, 0x77, 0xb2, 0x79, 0x58, 0xd9, 0x51, 0x50, 0x2b, 0xaf, 0xe8, 0xe8, 0xdf,
+    0x99, 0xb8, 0x5c, 0xc2, 0x02, 0x6c, 0x1c, 0x05, 0x40, 0x58, 0x00, 0x40, 0x58, 0x00, 0x40, 0x58,
+    0x00, 0x08, 0x0b, 0x00, 0x08, 0x0b, 0x00, 0x08, 0x0b, 0x00, 0x61, 0xe1, 0x3d, 0xfb, 0xd5, 0xbc,
+    0x7e, 0xef, 0xf3, 0xc9, 0xed, 0xbb, 0x6c, 0xf1, 0x73, 0x4f, 0xe3, 0x67, 0x6f, 0x19, 0xde, 0xca,
+    0xe2, 0x5a, 0xe9, 0x64, 0x98, 0xb5, 0xd1, 0x74, 0xf6, 0x46, 0xd6, 0xb3, 0x4d, 0xb6, 0xd1, 0x0d,
+    0xc4, 0xab, 0x1f, 0x93, 0x4c, 0xa9, 0xd8, 0xbb, 0x2a, 0x46, 0x66, 0x3c, 0xf6, 0x71, 0x3b, 0xdd,
+    0xcf, 0xea, 0xec, 0xae, 0x68, 0xfc, 0x5d, 0x76, 0x9d, 0xcf, 0x7c, 0x5d, 0x57, 0xfe, 0xed, 0x48,
+    0xec, 0xce, 0xce, 0xc2, 0xca, 0x8a, 0x8c, 0xb0, 0x36, 0x16, 0xd6, 0xd1, 0x88, 0xeb, 0x55, 0xa7,
+    0x7e, 0x35, 0x22, 0xab, 0x8c, 0x96, 0xb2, 0x51, 0x31, 0xa3, 0x6e, 0x17, 0x1f, 0x0d, 0x26, 0xcc,
+    0xde, 0xf2, 0x3e, 0xfb, 0x9a, 0x5a, 0xa9, 0xaf, 0x99, 0x0c, 0xb0, 0xca, 0x45, 0xe9, 0x2c, 0x85,
+    0x23, 0x53, 0x22, 0x75, 0x74, 0xec, 0xa2, 0x85, 0xef, 0xd9, 0xf7, 0x99, 0x2d, 0xbd, 0x6a, 0xdd,
+    0x8a, 0x3e, 0x53, 0x6e, 0x16, 0x4d, 0x18, 0x89, 0x3c, 0x36, 0x92, 0xf6, 0xbb, 0x90, 0xd0, 0xd6,
+    0x9c, 0xf7, 0x67, 0x32, 0xa4, 0xb2, 0xd1, 0x30, 0x99, 0x13, 0x2a, 0x12, 0x6b, 0x53, 0x49, 0x85,
+    0x88, 0x4c, 0xef, 0xb2, 0xc5, 0xd9, 0x91, 0x93, 0x2b, 0x5b, 0x08, 0x1e, 0x2d, 0x02, 0x1f, 0x1d,
+    0xaf, 0x53, 0x79, 0x7d, 0xad, 0xe3, 0x98, 0x11, 0x58, 0x46, 0x5a, 0x95, 0x11, 0x56, 0xb6, 0x58,
+    0x3f, 0xfa, 0x3e, 0xab, 0xbf, 0x93, 0x49, 0x3c, 0xb1, 0xe8, 0x9e, 0x6c, 0x9c, 0xd1, 0x49, 0x08,
+    0x99, 0x4c, 0xac, 0xe8, 0xef, 0x66, 0x0e, 0xf0, 0x28, 0x61, 0xb5, 0x5e, 0x6b, 0x8f, 0x54, 0xb2,
+    0x27, 0x51, 0xf5, 0xe2, 0xd3, 0x2b, 0xac, 0xd6, 0x7a, 0x68, 0xe4, 0xc2, 0x17, 0x0d, 0x92, 0x9c,
+    0x2d, 0xac, 0xe8, 0x0c, 0xa4, 0xda, 0x16, 0x3d, 0x89, 0x29, 0x84, 0x15, 0x58, 0xc3, 0x1a, 0x2d,
+    0x8a, 0x1e, 0x61, 0x8c, 0x58, 0xb7, 0xc8, 0xa6, 0x4b, 0xf4, 0x04, 0x0c, 0xf6, 0x8e, 0x82, 0x76,
+    0x11, 0x56, 0xe6, 0x02, 0x37, 0xe2, 0x02, 0x39, 0x5b, 0x58, 0xd5, 0xe7, 0xcc, 0x8a, 0xa9, 0xa7,
+    0x9f, 0x5a, 0x74, 0x4f, 0x4c, 0x17, 0xce, 0x3a, 0x46, 0x75, 0x8d, 0x65, 0xc4, 0x49, 0x33, 0x7a,
+    0x4a, 0x38, 0x22, 0x11, 0x35, 0x33, 0x65, 0xb8, 0x4a, 0x58, 0xa3, 0xa6, 0x4c, 0xbd, 0xd3, 0xa0,
+    0xea, 0xfb, 0xcc, 0x4c, 0x15, 0x8f, 0xd6, 0xdd, 0x56, 0x9a, 0x12, 0x66, 0x73, 0xdd, 0x1e, 0x29,
+    0xac, 0xc8, 0xc2, 0xe5, 0x47, 0xe3, 0xab, 0x67, 0x7a, 0x99, 0xf9, 0x98, 0xbd, 0xb2, 0x90, 0xdd,
+    0xb3, 0x9d, 0xe2, 0x6c, 0x71, 0xb4, 0xb2, 0x55, 0x20, 0x32, 0xa2, 0x8b, 0xfc, 0xfd, 0xd6, 0x07,
+    0x01, 0x91, 0xe3, 0x38, 0xe2, 0x43, 0x8b, 0xd6, 0xf1, 0x6c, 0x2d, 0xc2, 0x67, 0x8f, 0x63, 0x45,
+    0x36, 0xd9, 0xb6, 0x88, 0xfc, 0xbc, 0x72, 0x8c, 0x5a, 0x7d, 0x20, 0x33, 0xfd, 0x34, 0x25, 0xc4,
+    0xad, 0x37, 0x53, 0x7a, 0xcf, 0x20, 0x2c, 0x38, 0x81, 0xbd, 0x57, 0xc2, 0x02, 0x94, 0x8e, 0x78,
+    0x9f, 0x84, 0x05, 0x00, 0x84, 0x05, 0x80, 0xb0, 0x00, 0x80, 0xb0, 0x00, 0x80, 0xb0, 0x2c, 0xc8,
+    0x6a, 0x43, 0x10, 0x16, 0x46, 0x7d, 0x9c, 0x7d, 0x87, 0x93, 0xed, 0xdd, 0xef, 0x61, 0x66, 0x1c,
+    0x90, 0x1b, 0xdc, 0x12, 0x16, 0x61, 0x11, 0xd6, 0x36, 0xcf, 0x4f, 0x50, 0x84, 0xb5, 0xcd, 0x14,
+    0xa3, 0x7a, 0xcb, 0xfa, 0xa3, 0x12, 0xa3, 0x4c, 0x19, 0x47, 0x26, 0x7b, 0x2b, 0x52, 0x76, 0x93,
+    0xa9, 0x01, 0xcb, 0xfe, 0xad, 0x4c, 0x5a, 0x40, 0xe6, 0xb9, 0xa2, 0x25, 0x54, 0x67, 0xaf, 0xb3,
+    0x27, 0xc3, 0xac, 0x92, 0x0b, 0xd6, 0x8a, 0x9f, 0x01, 0x61, 0x4d, 0x5f, 0x17, 0xc9, 0x06, 0xb2,
+    0x8d, 0x48, 0x05, 0x88, 0x66, 0x6f, 0x45, 0x7e, 0xd6, 0x3a, 0x81, 0x33, 0x49, 0x0a, 0xd1, 0xc2,
+    0xda, 0x4a, 0x9c, 0xcb, 0xe8, 0x22, 0xe7, 0x4c, 0x3b, 0x8e, 0x2e, 0x6e, 0x26, 0x2d, 0xc2, 0x7a,
+    0xeb, 0x9a, 0xc8, 0xc8, 0xf8, 0x96, 0xde, 0xb0, 0xbe, 0x11, 0xc9, 0x02, 0x95, 0x22, 0xec, 0xde,
+    0x4c, 0xa8, 0x68, 0x6a, 0x45, 0xa6, 0x90, 0xbd, 0xd2, 0x36, 0x3d, 0xb9, 0x50, 0x19, 0x61, 0x99,
+    0x56, 0x12, 0xd6, 0xd6, 0xc2, 0x8a, 0xe6, 0x77, 0xbd, 0x5b, 0x58, 0x59, 0xd9, 0x64, 0xa6, 0xb9,
+    0x23, 0xb2, 0xcb, 0x46, 0xb5, 0x4d, 0xe5, 0xfb, 0x84, 0x45, 0x58, 0xb7, 0x17, 0x56, 0x26, 0xb1,
+    0x72, 0x35, 0x61, 0x55, 0xa6, 0x73, 0x23, 0xfe, 0x46, 0x54, 0x6a, 0x91, 0x18, 0xa2, 0xac, 0x80,
+    0x22, 0xef, 0x8d, 0xb0, 0x08, 0x6b, 0xb9, 0x35, 0xac, 0xec, 0x22, 0x6b, 0x44, 0x5a, 0x91, 0xfc,
+    0xae, 0xea, 0xf3, 0x64, 0x6f, 0xc0, 0x90, 0xc9, 0x5d, 0x8a, 0xdc, 0xf8, 0x22, 0xf2, 0xd8, 0xe8,
+    0xfa, 0x60, 0x74, 0xd1, 0xfd, 0xe8, 0xdf, 0x3d, 0xed, 0x1b, 0x39, 0x86, 0x95, 0xc5, 0x7b, 0xe7,
+    0x16, 0x61, 0xf9, 0x28, 0x1b, 0x20, 0x2c, 0xc2, 0xd2, 0x0e, 0x00, 0x61, 0x6d, 0x35, 0x1d, 0xd4,
+    0x19, 0x00, 0xc2, 0x02, 0x00, 0xc2, 0x02, 0x40, 0x58, 0x00, 0x40, 0x58, 0x4f, 0xe1, 0xef, 0x9f,
+    0x3f, 0x3f, 0x22, 0x68, 0x2b, 0x1c, 0xf1, 0xdf, 0xff, 0xfc, 0xeb, 0x23, 0x02, 0x61, 0xe1, 0xaf,
+    0xc8, 0x5e, 0x1d, 0xc2, 0x72, 0x9c, 0x67, 0xfe, 0x5d, 0xc2, 0x5a, 0x54, 0x58, 0xa3, 0x3e, 0xa5,
+    0xeb, 0xbd, 0x61, 0x69, 0x76, 0x57, 0x7b, 0x44, 0x58, 0xd5, 0x9f, 0x63, 0xec, 0x0d, 0x3c, 0xa3,
+    0x8f, 0x8d, 0xd6, 0x21, 0xce, 0xee, 0x3f, 0x5f, 0x85, 0x55, 0xfd, 0x39, 0x61, 0x2d, 0xbe, 0x0f,
+    0x6a, 0xc4, 0xad, 0xd2, 0x09, 0x6b, 0xfd, 0x92, 0xa9, 0x2b, 0x85, 0x55, 0x7d, 0x0d, 0x84, 0xf5,
+    0x50, 0x61, 0x55, 0x6e, 0xd3, 0x9d, 0xe9, 0x74, 0xad, 0x32, 0x8b, 0x56, 0x3d, 0x19, 0x61, 0xbd,
+    0x47, 0x58, 0x33, 0x72, 0xca, 0x2a, 0xc2, 0x9a, 0xd5, 0x7f, 0x08, 0x6b, 0x43, 0x61, 0x8d, 0xca,
+    0x99, 0x8a, 0x14, 0x37, 0xf7, 0x64, 0x1d, 0xbd, 0x7a, 0x5e, 0xc2, 0x7a, 0x6f, 0x51, 0xfa, 0xc8,
+    0x98, 0x9c, 0x6c, 0xf1, 0xf4, 0x88, 0xfe, 0x43, 0x58, 0x9b, 0x4f, 0x09, 0x7b, 0xb2, 0xa8, 0x7a,
+    0x46, 0x60, 0xd5, 0x4e, 0x4e, 0x58, 0xf3, 0x8a, 0xd2, 0x67, 0xe5, 0x94, 0x9d, 0x3d, 0xb6, 0xb5,
+    0x86, 0x35, 0x23, 0xfe, 0x86, 0xb0, 0x36, 0x9e, 0x12, 0xf6, 0xae, 0x2d, 0x64, 0xff, 0x7e, 0x6f,
+    0x74, 0x08, 0x21, 0x5d, 0x33, 0xf2, 0xee, 0x19, 0x25, 0x65, 0xe2, 0xab, 0xb3, 0x1f, 0x18, 0x8d,
+    0x88, 0x9e, 0x79, 0xb0, 0x90, 0xf6, 0x12, 0x56, 0x25, 0x66, 0xb7, 0xb5, 0x4e, 0x90, 0x99, 0x72,
+    0xbe, 0xfa, 0x5b, 0xd5, 0x11, 0xd6, 0x4e, 0xbc, 0x7a, 0xdd, 0xad, 0xef, 0x7d, 0xfe, 0x7b, 0x17,
+    0x61, 0x65, 0x97, 0x02, 0xa2, 0xa3, 0xb3, 0xd1, 0xfd, 0x27, 0xb3, 0xad, 0x61, 0x25, 0x5e, 0xbd,
+    0xee, 0xd6, 0xf7, 0x3e, 0xff, 0xbd, 0xe5, 0xb6, 0x86, 0x56, 0xce, 0x51, 0x76, 0xd4, 0x15, 0x59,
+    0xa0, 0x6d, 0x5d, 0x25, 0xa3, 0xb9, 0x50, 0x84, 0x75, 0xdd, 0x76, 0x97, 0xd1, 0x39, 0x65, 0x67,
+    0x6b, 0x5f, 0x91, 0xd7, 0x30, 0xba, 0xff, 0x10, 0x96, 0x8d, 0xa3, 0x00, 0x4c, 0x09, 0xd1, 0x53,
+    0xba, 0xa3, 0x2d, 0xd0, 0x5b, 0xba, 0x43, 0x58, 0x00, 0x40, 0x58, 0x00, 0x40, 0x58, 0x00, 0x08,
+    0x0b, 0x00, 0x08, 0x0b, 0x00, 0x08, 0x0b, 0x00, 0x61, 0x01, 0xc0, 0x7d, 0x84, 0x35, 0x22, 0x7c,
+    0x2f, 0x52, 0x00, 0x9d, 0x7d, 0x1e, 0xb7, 0xef, 0x02, 0xc6, 0x56, 0x1e, 0xbc, 0xcb, 0x11, 0xc3,
+    0x84, 0x95, 0x7d, 0x23, 0x67, 0xb7, 0x30, 0x9f, 0xf1, 0xa6, 0xb3, 0x79, 0x5a, 0x57, 0x94, 0x20,
+    0x39, 0x01, 0xb0, 0x42, 0xf2, 0xc5, 0x95, 0xd2, 0x19, 0xd8, 0xf7, 0xaf, 0x3b, 0x09, 0x7b, 0xab,
+    0xd8, 0x47, 0x09, 0x2b, 0x9b, 0xf6, 0x30, 0x7a, 0x04, 0x4a, 0x5a, 0x78, 0x67, 0xea, 0xc5, 0x3b,
+    0x85, 0x35, 0xa0, 0xef, 0x8f, 0x2b, 0x5a, 0x3e, 0x2b, 0x08, 0xcd, 0x64, 0x5e, 0x45, 0x0b, 0x4a,
+    0x23, 0x06, 0xaf, 0x56, 0xdb, 0x1f, 0x15, 0xc2, 0x1e, 0x15, 0xb0, 0x56, 0x9f, 0xff, 0x2c, 0xeb,
+    0x09, 0x98, 0xb9, 0x64, 0x13, 0x49, 0x6e, 0xad, 0x9c, 0xa3, 0x19, 0x2f, 0x5c, 0x22, 0xac, 0x8f,
+    0xc4, 0x57, 0x56, 0x58, 0x99, 0x48, 0xda, 0x9e, 0xf8, 0x8e, 0x4a, 0x20, 0x5c, 0x26, 0xfa, 0x26,
+    0x2b, 0x4c, 0xd2, 0xc2, 0x95, 0x6b, 0x50, 0x3d, 0x89, 0xac, 0x91, 0x73, 0x74, 0xa2, 0xb4, 0xde,
+    0x33, 0xc2, 0x8a, 0xe6, 0x5e, 0x8f, 0x8a, 0xb4, 0xcd, 0x5e, 0x5d, 0xce, 0xde, 0xc3, 0xa8, 0xf0,
+    0xc0, 0xea, 0xd4, 0x18, 0xe8, 0x1d, 0x6d, 0xf5, 0xdc, 0x4c, 0xa3, 0x75, 0x8e, 0x2c, 0x37, 0xc2,
+    0xaa, 0xcc, 0x4b, 0xa3, 0x21, 0x7a, 0x55, 0x61, 0x65, 0x52, 0x24, 0xab, 0xc2, 0xc8, 0x86, 0x04,
+    0x12, 0x16, 0x76, 0xfc, 0xc4, 0x2f, 0xb2, 0x24, 0xb3, 0xdd, 0x1a, 0x56, 0x65, 0xf5, 0x3f, 0x3b,
+    0xdd, 0xaa, 0x0c, 0x51, 0x2b, 0xc2, 0xaa, 0x4e, 0x11, 0xa3, 0xb2, 0x99, 0x11, 0xa1, 0x0b, 0xf4,
+    0x2c, 0xba, 0xcf, 0x9a, 0x12, 0x2e, 0xfd, 0x29, 0x61, 0xe5, 0x24, 0x8b, 0xa4, 0x3d, 0x46, 0xa7,
+    0x6b, 0xad, 0x69, 0x5c, 0x34, 0x99, 0xb2, 0x27, 0xd5, 0x34, 0x7a, 0xe5, 0xc8, 0xbe, 0x16, 0x27,
+    0x1a, 0x66, 0x6f, 0x69, 0xc8, 0x2c, 0x89, 0xf4, 0x6e, 0x05, 0x5a, 0x66, 0x1f, 0x96, 0x4f, 0x5c,
+    0x00, 0x28, 0xcd, 0xd9, 0x78, 0xb1, 0x12, 0x00, 0x61, 0x6d, 0x5d, 0x9a, 0x00, 0x80, 0xb0, 0x00,
+    0x3c, 0x88, 0xff, 0x01, 0x3f, 0xf7, 0x9e, 0x8b, 0x65, 0xb0, 0xe4, 0x47, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
 };
 #endif
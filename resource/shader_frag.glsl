@@ -1,9 +1,12 @@
 #version 440
 
+// Variants are compiled with any of BORDER_FADE, MAP_CACHE, MAP_OVERVIEW, MINIMAP and OVERDRAW defined, see 'build_rect_program'
+
 layout(location = 0) in frag_data {
     vec2 pixel;
     vec2 position;
     vec2 uv;
+    flat uint layer;
 } frag;
 
 layout(binding = 0, std140) uniform screen_info {
@@ -11,30 +14,86 @@ layout(binding = 0, std140) uniform screen_info {
 } screen;
 
 layout(binding = 1, std140) uniform translation_info {
-    vec2 position;
-    uint scale;
-    bool enabled;
+    vec2 start;
+    vec2 target;
+    float start_scale;
+    float target_scale;
+    float start_time;
+    float duration;
+    // Seconds on the same clock as the start time, written with the frame
+    float time;
 } translation;
 
-layout(binding = 0) uniform sampler2D image;
-uniform bool border_fade = false;
+layout(binding = 0) uniform sampler2DArray image;
+layout(binding = 1) uniform sampler2DArray image_linear;
+// The map drawn ahead of time, see 'render_map_cache'
+layout(binding = 3) uniform sampler2D map_cache;
+// One texel per grid cell, see 'render_map_overview'
+layout(binding = 4) uniform sampler2D map_overview;
+// Part of the overview the minimap shows, position and size
+uniform vec4 minimap_area;
+// Area of each layer its image covers
+uniform vec2 layer_scale[4];
+// Layers sampled with the linear filter, one bit per layer
+uniform uint linear_layers;
+#ifdef OVERDRAW
+// Fragments drawn to each pixel and in the whole frame, see 'render_overdraw'
+layout(binding = 0, r32ui) uniform coherent uimage2D overdraw;
+layout(binding = 0, offset = 0) uniform atomic_uint fragments;
+#endif
 
 layout(location = 0) out vec4 out_color;
 
 const int border_begin = 8;
 const int border_length = 32;
+// Half the room size over the grid cell size
+const float room_extent = 0.4;
 
 void main() {
-    vec4 color = texture(image, frag.uv);
+#ifdef OVERDRAW
+    imageAtomicAdd(overdraw, ivec2(gl_FragCoord.xy), 1u);
+    atomicCounterIncrement(fragments);
+#endif
+
+    // Clamped half a texel inside the image so filtering never reads the unused part of the layer
+    vec2 scale = layer_scale[frag.layer];
+    vec2 inset = 0.5 / (vec2(textureSize(image, 0).xy) * scale);
+    vec2 uv = clamp(frag.uv, inset, 1.0 - inset) * scale;
+
+    // Gradients are taken outside the sampler selection since it differs between instances
+    vec2 uv_dx = dFdx(uv);
+    vec2 uv_dy = dFdy(uv);
+
+    vec4 color;
+#if defined(MAP_CACHE)
+    color = textureLod(map_cache, frag.uv, 0);
+#elif defined(MAP_OVERVIEW)
+#ifdef MINIMAP
+    vec2 cell_uv = minimap_area.xy + frag.uv * minimap_area.zw;
+#else
+    vec2 cell_uv = frag.uv;
+#endif
+    vec2 cell_dx = dFdx(cell_uv);
+    vec2 cell_dy = dFdy(cell_uv);
+
+    // Mipmaps take over once a cell is smaller than a pixel, while a cell still spans a few the gaps between rooms are kept
+    vec2 cells = vec2(textureSize(map_overview, 0));
+    color = textureGrad(map_overview, cell_uv, cell_dx, cell_dy);
+    vec2 local = fract(cell_uv * cells) - 0.5;
+    if (1.0 / (length(cell_dx) * cells.x) >= 4.0 && any(greaterThan(abs(local), vec2(room_extent)))) color.a = 0.0;
+#else
+    if (((linear_layers >> frag.layer) & 1u) != 0u) color = textureGrad(image_linear, vec3(uv, frag.layer), uv_dx, uv_dy);
+    else color = textureGrad(image, vec3(uv, frag.layer), uv_dx, uv_dy);
+#endif
     //    if(!alpha && color.a < 0.5) discard;
-    if (border_fade) {
-        ivec2 s = ivec2(screen.size) / 2;
-        ivec2 p = ivec2(abs(frag.position * vec2(screen.size) * 0.5));
+#ifdef BORDER_FADE
+    ivec2 s = ivec2(screen.size) / 2;
+    ivec2 p = ivec2(abs(frag.position * vec2(screen.size) * 0.5));
 
-        vec2 n = clamp(p - s + (border_begin + border_length).xx, 0, border_length);
-        float q = max(n.x, n.y);
+    vec2 n = clamp(p - s + (border_begin + border_length).xx, 0, border_length);
+    float q = max(n.x, n.y);
 
-        color.a *= 1 - (q / float(border_length));
-    }
+    color.a *= 1 - (q / float(border_length));
+#endif
     out_color = color;
 }
\ No newline at end of file
@@ -4,10 +4,13 @@
 inline constexpr char shader_frag[] {
         "#version 440\n"
         "\n"
+        "// Variants are compiled with any of BORDER_FADE, MAP_CACHE, MAP_OVERVIEW, MINIMAP and OVERDRAW defined, see 'build_rect_program'\n"
+        "\n"
         "layout(location = 0) in frag_data {\n"
         "    vec2 pixel;\n"
         "    vec2 position;\n"
         "    vec2 uv;\n"
+        "    flat uint layer;\n"
         "} frag;\n"
         "\n"
         "layout(binding = 0, std140) uniform screen_info {\n"
@@ -15,31 +18,87 @@ inline constexpr char shader_frag[] {
         "} screen;\n"
         "\n"
         "layout(binding = 1, std140) uniform translation_info {\n"
-        "    vec2 position;\n"
-        "    uint scale;\n"
-        "    bool enabled;\n"
+        "    vec2 start;\n"
+        "    vec2 target;\n"
+        "    float start_scale;\n"
+        "    float target_scale;\n"
+        "    float start_time;\n"
+        "    float duration;\n"
+        "    // Seconds on the same clock as the start time, written with the frame\n"
+        "    float time;\n"
         "} translation;\n"
         "\n"
-        "layout(binding = 0) uniform sampler2D image;\n"
-        "uniform bool border_fade = false;\n"
+        "layout(binding = 0) uniform sampler2DArray image;\n"
+        "layout(binding = 1) uniform sampler2DArray image_linear;\n"
+        "// The map drawn ahead of time, see 'render_map_cache'\n"
+        "layout(binding = 3) uniform sampler2D map_cache;\n"
+        "// One texel per grid cell, see 'render_map_overview'\n"
+        "layout(binding = 4) uniform sampler2D map_overview;\n"
+        "// Part of the overview the minimap shows, position and size\n"
+        "uniform vec4 minimap_area;\n"
+        "// Area of each layer its image covers\n"
+        "uniform vec2 layer_scale[4];\n"
+        "// Layers sampled with the linear filter, one bit per layer\n"
+        "uniform uint linear_layers;\n"
+        "#ifdef OVERDRAW\n"
+        "// Fragments drawn to each pixel and in the whole frame, see 'render_overdraw'\n"
+        "layout(binding = 0, r32ui) uniform coherent uimage2D overdraw;\n"
+        "layout(binding = 0, offset = 0) uniform atomic_uint fragments;\n"
+        "#endif\n"
         "\n"
         "layout(location = 0) out vec4 out_color;\n"
         "\n"
         "const int border_begin = 8;\n"
         "const int border_length = 32;\n"
+        "// Half the room size over the grid cell size\n"
+        "const float room_extent = 0.4;\n"
         "\n"
         "void main() {\n"
-        "    vec4 color = texture(image, frag.uv);\n"
+        "#ifdef OVERDRAW\n"
+        "    imageAtomicAdd(overdraw, ivec2(gl_FragCoord.xy), 1u);\n"
+        "    atomicCounterIncrement(fragments);\n"
+        "#endif\n"
+        "\n"
+        "    // Clamped half a texel inside the image so filtering never reads the unused part of the layer\n"
+        "    vec2 scale = layer_scale[frag.layer];\n"
+        "    vec2 inset = 0.5 / (vec2(textureSize(image, 0).xy) * scale);\n"
+        "    vec2 uv = clamp(frag.uv, inset, 1.0 - inset) * scale;\n"
+        "\n"
+        "    // Gradients are taken outside the sampler selection since it differs between instances\n"
+        "    vec2 uv_dx = dFdx(uv);\n"
+        "    vec2 uv_dy = dFdy(uv);\n"
+        "\n"
+        "    vec4 color;\n"
+        "#if defined(MAP_CACHE)\n"
+        "    color = textureLod(map_cache, frag.uv, 0);\n"
+        "#elif defined(MAP_OVERVIEW)\n"
+        "#ifdef MINIMAP\n"
+        "    vec2 cell_uv = minimap_area.xy + frag.uv * minimap_area.zw;\n"
+        "#else\n"
+        "    vec2 cell_uv = frag.uv;\n"
+        "#endif\n"
+        "    vec2 cell_dx = dFdx(cell_uv);\n"
+        "    vec2 cell_dy = dFdy(cell_uv);\n"
+        "\n"
+        "    // Mipmaps take over once a cell is smaller than a pixel, while a cell still spans a few the gaps between rooms are kept\n"
+        "    vec2 cells = vec2(textureSize(map_overview, 0));\n"
+        "    color = textureGrad(map_overview, cell_uv, cell_dx, cell_dy);\n"
+        "    vec2 local = fract(cell_uv * cells) - 0.5;\n"
+        "    if (1.0 / (length(cell_dx) * cells.x) >= 4.0 && any(greaterThan(abs(local), vec2(room_extent)))) color.a = 0.0;\n"
+        "#else\n"
+        "    if (((linear_layers >> frag.layer) & 1u) != 0u) color = textureGrad(image_linear, vec3(uv, frag.layer), uv_dx, uv_dy);\n"
+        "    else color = textureGrad(image, vec3(uv, frag.layer), uv_dx, uv_dy);\n"
+        "#endif\n"
         "    //    if(!alpha && color.a < 0.5) discard;\n"
-        "    if (border_fade) {\n"
-        "        ivec2 s = ivec2(screen.size) / 2;\n"
-        "        ivec2 p = ivec2(abs(frag.position * vec2(screen.size) * 0.5));\n"
+        "#ifdef BORDER_FADE\n"
+        "    ivec2 s = ivec2(screen.size) / 2;\n"
+        "    ivec2 p = ivec2(abs(frag.position * vec2(screen.size) * 0.5));\n"
         "\n"
-        "        vec2 n = clamp(p - s + (border_begin + border_length).xx, 0, border_length);\n"
-        "        float q = max(n.x, n.y);\n"
+        "    vec2 n = clamp(p - s + (border_begin + border_length).xx, 0, border_length);\n"
+        "    float q = max(n.x, n.y);\n"
         "\n"
-        "        color.a *= 1 - (q / float(border_length));\n"
-        "    }\n"
+        "    color.a *= 1 - (q / float(border_length));\n"
+        "#endif\n"
         "    out_color = color;\n"
         "}"
 };
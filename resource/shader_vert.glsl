@@ -1,42 +1,78 @@
 #version 440
 
+// Variants are compiled with TRANSLATED defined, see 'build_rect_program'
+
 layout(location = 0) in vec3 vertex;
 layout(location = 1) in vec2 uv;
 // Instanced
 layout(location = 2) in ivec2 position;
-layout(location = 3) in uvec2 size;
-layout(location = 4) in vec2 uv_position;
-layout(location = 5) in vec2 uv_size;
-layout(location = 6) in uint uv_tr;
+layout(location = 3) in uint sprite;
+layout(location = 4) in uint uv_tr;
 
 layout(binding = 0, std140) uniform screen_info {
     uvec2 size;
 } screen;
 
+// A view move, evaluated for the current time so the whole move is one write
 layout(binding = 1, std140) uniform translation_info {
-    vec2 position;
-    uint scale;
-    bool enabled;
+    vec2 start;
+    vec2 target;
+    float start_scale;
+    float target_scale;
+    float start_time;
+    float duration;
+    // Seconds on the same clock as the start time, written with the frame
+    float time;
 } translation;
 
+struct sprite_data {
+    vec2 uv_position;
+    vec2 uv_size;
+    uvec2 size;
+    uint layer;
+};
+
+layout(binding = 2, std140) uniform sprite_table {
+    sprite_data sprites[512];
+};
+
 layout(location = 0) out frag_data {
     vec2 pixel;
     vec2 position;
     vec2 uv;
+    flat uint layer;
 } frag;
 
 vec2
 transform_uv(vec2 uv, uint index);
 
+// Eased out like 'update' on the CPU
+float
+view_progress() {
+    float t = translation.duration > 0.0 ? clamp((translation.time - translation.start_time) / translation.duration, 0.0, 1.0) : 1.0;
+    return 1.0 - pow(1.0 - t, 3.0);
+}
+
 void main() {
+    vec2 uv_position = sprites[sprite].uv_position;
+    vec2 uv_size = sprites[sprite].uv_size;
+    uvec2 size = sprites[sprite].size;
+    // Quads covering the whole screen, see 'screen_rect'
+    if (size == uvec2(0xFFFFFFFFu)) size = screen.size;
+
     vec2 pixel = vec2(2.0 / float(screen.size.x), 2.0 / float(screen.size.y));
     frag.uv = uv_position + (uv_size * transform_uv(uv, uv_tr));
 
     vec2 pixel_position = vec2(position.x, -position.y) * pixel + vec2(-1, 1);
     vec2 current_position = vec2(vertex.xy * pixel * size + pixel_position);
-    if (translation.enabled) current_position = (vec2(translation.position.x, -translation.position.y) * pixel + current_position) * float(translation.scale);
+#ifdef TRANSLATED
+    float progress = view_progress();
+    vec2 view = mix(translation.start, translation.target, progress);
+    current_position = (vec2(view.x, -view.y) * pixel + current_position) * mix(translation.start_scale, translation.target_scale, progress);
+#endif
 
     frag.pixel = pixel;
+    frag.layer = sprites[sprite].layer;
     frag.position = current_position;
     gl_Position = vec4(current_position, vertex.z, 1.0);
 }
@@ -4,43 +4,79 @@
 inline constexpr char shader_vert[] {
         "#version 440\n"
         "\n"
+        "// Variants are compiled with TRANSLATED defined, see 'build_rect_program'\n"
+        "\n"
         "layout(location = 0) in vec3 vertex;\n"
         "layout(location = 1) in vec2 uv;\n"
         "// Instanced\n"
         "layout(location = 2) in ivec2 position;\n"
-        "layout(location = 3) in uvec2 size;\n"
-        "layout(location = 4) in vec2 uv_position;\n"
-        "layout(location = 5) in vec2 uv_size;\n"
-        "layout(location = 6) in uint uv_tr;\n"
+        "layout(location = 3) in uint sprite;\n"
+        "layout(location = 4) in uint uv_tr;\n"
         "\n"
         "layout(binding = 0, std140) uniform screen_info {\n"
         "    uvec2 size;\n"
         "} screen;\n"
         "\n"
+        "// A view move, evaluated for the current time so the whole move is one write\n"
         "layout(binding = 1, std140) uniform translation_info {\n"
-        "    vec2 position;\n"
-        "    uint scale;\n"
-        "    bool enabled;\n"
+        "    vec2 start;\n"
+        "    vec2 target;\n"
+        "    float start_scale;\n"
+        "    float target_scale;\n"
+        "    float start_time;\n"
+        "    float duration;\n"
+        "    // Seconds on the same clock as the start time, written with the frame\n"
+        "    float time;\n"
         "} translation;\n"
         "\n"
+        "struct sprite_data {\n"
+        "    vec2 uv_position;\n"
+        "    vec2 uv_size;\n"
+        "    uvec2 size;\n"
+        "    uint layer;\n"
+        "};\n"
+        "\n"
+        "layout(binding = 2, std140) uniform sprite_table {\n"
+        "    sprite_data sprites[512];\n"
+        "};\n"
+        "\n"
         "layout(location = 0) out frag_data {\n"
         "    vec2 pixel;\n"
         "    vec2 position;\n"
         "    vec2 uv;\n"
+        "    flat uint layer;\n"
         "} frag;\n"
         "\n"
         "vec2\n"
         "transform_uv(vec2 uv, uint index);\n"
         "\n"
+        "// Eased out like 'update' on the CPU\n"
+        "float\n"
+        "view_progress() {\n"
+        "    float t = translation.duration > 0.0 ? clamp((translation.time - translation.start_time) / translation.duration, 0.0, 1.0) : 1.0;\n"
+        "    return 1.0 - pow(1.0 - t, 3.0);\n"
+        "}\n"
+        "\n"
         "void main() {\n"
+        "    vec2 uv_position = sprites[sprite].uv_position;\n"
+        "    vec2 uv_size = sprites[sprite].uv_size;\n"
+        "    uvec2 size = sprites[sprite].size;\n"
+        "    // Quads covering the whole screen, see 'screen_rect'\n"
+        "    if (size == uvec2(0xFFFFFFFFu)) size = screen.size;\n"
+        "\n"
         "    vec2 pixel = vec2(2.0 / float(screen.size.x), 2.0 / float(screen.size.y));\n"
         "    frag.uv = uv_position + (uv_size * transform_uv(uv, uv_tr));\n"
         "\n"
         "    vec2 pixel_position = vec2(position.x, -position.y) * pixel + vec2(-1, 1);\n"
         "    vec2 current_position = vec2(vertex.xy * pixel * size + pixel_position);\n"
-        "    if (translation.enabled) current_position = (vec2(translation.position.x, -translation.position.y) * pixel + current_position) * float(translation.scale);\n"
+        "#ifdef TRANSLATED\n"
+        "    float progress = view_progress();\n"
+        "    vec2 view = mix(translation.start, translation.target, progress);\n"
+        "    current_position = (vec2(view.x, -view.y) * pixel + current_position) * mix(translation.start_scale, translation.target_scale, progress);\n"
+        "#endif\n"
         "\n"
         "    frag.pixel = pixel;\n"
+        "    frag.layer = sprites[sprite].layer;\n"
         "    frag.position = current_position;\n"
         "    gl_Position = vec4(current_position, vertex.z, 1.0);\n"
         "}\n"
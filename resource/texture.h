@@ -2,164 +2,109 @@
 inline constexpr unsigned char texture[] {
     0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
     0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x08, 0x06, 0x00, 0x00, 0x00, 0xc3, 0x3e, 0x61,
-    0xcb, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xae, 0xce, 0x1c, 0xe9, 0x00, 0x00,
-    0x09, 0xc4, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0xed, 0x9d, 0x4f, 0x68, 0x1c, 0x55, 0x1c, 0xc7,
-    0xbf, 0xd3, 0x6e, 0xa8, 0xb5, 0x76, 0x93, 0xb4, 0xa0, 0xa5, 0x06, 0xa4, 0x60, 0x7b, 0x10, 0x45,
-    0x18, 0x25, 0x10, 0x08, 0x8a, 0x94, 0x06, 0x05, 0x0f, 0x1e, 0x82, 0x57, 0x0b, 0x9e, 0x3c, 0x59,
-    0x6f, 0xb2, 0x3d, 0x79, 0x68, 0xd0, 0x9b, 0x9e, 0xc4, 0x83, 0xa2, 0xf7, 0x1c, 0x05, 0x25, 0x45,
-    0x0a, 0x6d, 0x20, 0x12, 0x64, 0x40, 0x2c, 0x7a, 0x29, 0x84, 0x82, 0xf6, 0xa4, 0x6e, 0xb2, 0xc9,
-    0x86, 0xc8, 0x4c, 0x32, 0x1e, 0x92, 0xb7, 0x7d, 0x33, 0x99, 0x3f, 0xbf, 0xdf, 0xdb, 0xf7, 0xe6,
-    0xcd, 0xee, 0xbc, 0x0f, 0x2c, 0xed, 0x6e, 0x67, 0x7f, 0xbf, 0x65, 0x7e, 0xbf, 0xf7, 0x7b, 0xbf,
-    0xf7, 0x9b, 0xf7, 0x7e, 0xf5, 0x00, 0xc4, 0x68, 0x30, 0x61, 0x6f, 0x36, 0xf1, 0x7e, 0xa2, 0xbd,
-    0xee, 0x95, 0x7d, 0xc7, 0x9f, 0x9f, 0x8b, 0x83, 0xd5, 0x35, 0x0f, 0x00, 0x1e, 0x3d, 0x7a, 0x54,
-    0x78, 0xff, 0x2e, 0x5e, 0xbc, 0x58, 0x2a, 0xcf, 0x26, 0x2d, 0x00, 0xe8, 0xdc, 0xba, 0x65, 0x45,
-    0xf9, 0xd2, 0xcd, 0x9b, 0xa8, 0x83, 0x7e, 0x0e, 0xfe, 0xfc, 0x5c, 0x2c, 0xfe, 0x0c, 0x56, 0xd7,
-    0xbc, 0x7e, 0xbf, 0xaf, 0xf5, 0x37, 0xfd, 0x7e, 0xff, 0x83, 0x5c, 0x87, 0x7a, 0xe1, 0xc5, 0x2f,
-    0x49, 0xce, 0xc4, 0x91, 0xd1, 0x12, 0x7f, 0xf9, 0xf1, 0x87, 0xef, 0x29, 0xb2, 0xb5, 0xf1, 0xe6,
-    0x5b, 0x6f, 0x27, 0xde, 0xdb, 0xd6, 0x4f, 0x25, 0x58, 0x5d, 0xf3, 0xe4, 0x08, 0x70, 0xf9, 0xf2,
-    0x65, 0xad, 0x23, 0x9c, 0x6a, 0x64, 0x5d, 0x32, 0x5a, 0xf2, 0x1b, 0x53, 0x46, 0xa1, 0xca, 0xb5,
-    0xad, 0x9f, 0x8a, 0x30, 0xbe, 0x6e, 0xd2, 0x23, 0x57, 0x87, 0x33, 0x94, 0xc9, 0x6d, 0xa5, 0x2f,
-    0x36, 0x31, 0x12, 0x65, 0x99, 0x65, 0x23, 0xaf, 0x6a, 0xfd, 0x94, 0x39, 0x3f, 0x8d, 0x1c, 0x01,
-    0x74, 0xf0, 0xfb, 0xfd, 0x0f, 0x62, 0x61, 0x14, 0x5d, 0x46, 0x97, 0x91, 0x65, 0x0a, 0x67, 0x10,
-    0x3a, 0x4f, 0xe8, 0x56, 0x36, 0xee, 0xf8, 0xf3, 0x73, 0xf1, 0xbb, 0x4b, 0x57, 0x06, 0xb9, 0xc0,
-    0xa8, 0xe3, 0x1c, 0x80, 0x49, 0xb0, 0xba, 0xe6, 0x3d, 0x7f, 0xe3, 0x37, 0x63, 0xd3, 0x40, 0xd5,
-    0x24, 0x1c, 0xa0, 0x8a, 0x44, 0xac, 0x48, 0x87, 0x6d, 0xfd, 0x54, 0x16, 0x83, 0xc0, 0x88, 0xf1,
-    0x4d, 0x84, 0xff, 0x32, 0x1d, 0xc7, 0x72, 0x80, 0xa6, 0xf1, 0xf5, 0xcb, 0x2f, 0x27, 0x42, 0xf9,
-    0xfb, 0xbf, 0xfe, 0xca, 0xaa, 0x03, 0x5c, 0xbb, 0x76, 0xad, 0x70, 0x2a, 0xb8, 0x7d, 0xfb, 0x76,
-    0xad, 0x23, 0x85, 0x9b, 0x02, 0x98, 0x88, 0x1c, 0x60, 0xd9, 0xf7, 0x63, 0x00, 0xd8, 0xdb, 0xdb,
-    0x2b, 0x7c, 0xd5, 0x1d, 0xe5, 0x08, 0x30, 0xd9, 0x9e, 0x4e, 0xbc, 0xdf, 0xea, 0x75, 0x87, 0xfe,
-    0x31, 0xa3, 0xa0, 0x3f, 0x58, 0x5d, 0xf3, 0xd0, 0x41, 0x1c, 0x1c, 0x4d, 0x03, 0xf7, 0xee, 0xdd,
-    0xab, 0xf5, 0x08, 0x2f, 0x83, 0x1d, 0x01, 0x26, 0xdb, 0xd3, 0xc7, 0x6e, 0x7e, 0xd1, 0xe7, 0x45,
-    0xa8, 0x54, 0x00, 0x75, 0xea, 0x57, 0x45, 0x77, 0x02, 0x58, 0xc5, 0xdc, 0x9f, 0xa7, 0x93, 0x15,
-    0x01, 0x28, 0x37, 0x78, 0xb2, 0x3d, 0x4d, 0x1a, 0x8d, 0x2a, 0xc9, 0x98, 0x4e, 0xfd, 0x02, 0xca,
-    0x9c, 0x9f, 0x46, 0x77, 0x1d, 0xc0, 0x26, 0x2e, 0x07, 0x60, 0x92, 0xce, 0x01, 0x46, 0x1d, 0xb2,
-    0x03, 0x70, 0xc2, 0xab, 0x89, 0x50, 0x6c, 0x5b, 0xbf, 0x40, 0xd4, 0x01, 0x4c, 0x2d, 0x05, 0xab,
-    0xc6, 0x45, 0x00, 0x05, 0xc6, 0xc5, 0xf8, 0x80, 0x73, 0x00, 0x25, 0xe4, 0xf0, 0x1f, 0xe7, 0x20,
-    0x5f, 0x9f, 0x7e, 0x5f, 0x27, 0x9c, 0x03, 0x30, 0xf1, 0xe7, 0xe7, 0xe2, 0x07, 0x9f, 0xbf, 0x34,
-    0x78, 0x16, 0xe0, 0x79, 0x9e, 0x27, 0xfe, 0x14, 0x88, 0x6b, 0xb3, 0x9c, 0xa1, 0x6e, 0x90, 0x57,
-    0x01, 0x5b, 0xbd, 0x2e, 0x79, 0x6e, 0x35, 0xb1, 0x26, 0xb7, 0xad, 0x5f, 0x30, 0xa8, 0x03, 0x14,
-    0xac, 0x02, 0x64, 0xa7, 0x00, 0xea, 0x1d, 0x01, 0x1a, 0x5f, 0x0a, 0x56, 0x21, 0xcb, 0xf8, 0xb2,
-    0x91, 0xe5, 0x28, 0x50, 0x77, 0x58, 0x53, 0x00, 0x65, 0x64, 0x51, 0x47, 0xdf, 0x9b, 0x6f, 0xbd,
-    0xcd, 0xde, 0x95, 0xa3, 0x53, 0xff, 0x30, 0x64, 0x2d, 0x01, 0xb3, 0xa6, 0x80, 0x51, 0x80, 0x9d,
-    0x03, 0x6c, 0xf5, 0xba, 0x99, 0x37, 0x39, 0xef, 0xf3, 0x22, 0x54, 0xf6, 0xe4, 0xe9, 0xd4, 0xaf,
-    0x82, 0x3f, 0x3f, 0x17, 0x2f, 0x3d, 0x79, 0x4a, 0xeb, 0x7e, 0x80, 0xa2, 0x3d, 0x7c, 0xa6, 0x10,
-    0x3a, 0x95, 0xa7, 0x80, 0xaa, 0x6b, 0xff, 0x75, 0xd1, 0x1f, 0xac, 0xae, 0x79, 0xcb, 0xbe, 0x1f,
-    0x8f, 0xcb, 0x52, 0xd0, 0xad, 0x02, 0x14, 0x90, 0x8d, 0x2f, 0xe6, 0xfe, 0xac, 0x44, 0x4f, 0x5e,
-    0x05, 0xd4, 0x75, 0x45, 0xe0, 0x1c, 0x40, 0x01, 0x39, 0x07, 0x28, 0x9a, 0xfb, 0xbd, 0x0c, 0xaa,
-    0xfd, 0xa5, 0xe5, 0x24, 0x1c, 0x40, 0x75, 0xab, 0x34, 0x87, 0x22, 0x1d, 0xb6, 0xf5, 0x53, 0x10,
-    0x75, 0x00, 0x13, 0xcf, 0x02, 0xaa, 0xc8, 0x05, 0xd2, 0x3a, 0xdc, 0x32, 0x90, 0x49, 0x7a, 0x3f,
-    0xc0, 0xa8, 0xe3, 0xa6, 0x00, 0x05, 0xc6, 0xe5, 0x51, 0x30, 0x90, 0x11, 0x01, 0xe4, 0x10, 0x69,
-    0xea, 0x60, 0x06, 0xf5, 0x5a, 0x1b, 0xfa, 0x29, 0xe8, 0x5e, 0x05, 0x64, 0xed, 0xdb, 0x4f, 0x7f,
-    0x3e, 0x0c, 0x59, 0x53, 0x4b, 0xe6, 0x86, 0x10, 0x53, 0xbb, 0x72, 0xa9, 0x72, 0x6d, 0xeb, 0xa7,
-    0xe0, 0xcf, 0xcf, 0xc5, 0x0f, 0x96, 0xae, 0x60, 0xf9, 0x06, 0xb4, 0x2f, 0x05, 0x4d, 0xed, 0x0c,
-    0x2a, 0x92, 0x3b, 0x70, 0x00, 0xea, 0x28, 0x29, 0xbb, 0x99, 0xaa, 0xa3, 0xcd, 0xb6, 0x7e, 0x2a,
-    0xc1, 0xea, 0x9a, 0xd7, 0xb9, 0xf1, 0x9f, 0xb1, 0x3a, 0x40, 0xd5, 0x87, 0x43, 0x3d, 0x30, 0x8e,
-    0x87, 0x77, 0x6e, 0xdd, 0x22, 0x19, 0x40, 0xa5, 0xc2, 0x67, 0x51, 0xff, 0xd8, 0xcc, 0xe7, 0x2a,
-    0xb8, 0x55, 0x80, 0x02, 0xa9, 0x3d, 0x81, 0xf1, 0x87, 0x9d, 0x0e, 0xee, 0xfc, 0xb4, 0x52, 0xf8,
-    0x9d, 0x37, 0xae, 0x2e, 0xe0, 0x8b, 0xa5, 0x25, 0xa0, 0x66, 0x0e, 0x67, 0xa4, 0x3f, 0x00, 0x55,
-    0x9e, 0xa9, 0xfe, 0x00, 0x5c, 0xfd, 0x1c, 0x96, 0x7d, 0x3f, 0x7e, 0xb0, 0x74, 0x05, 0xf2, 0x23,
-    0xe1, 0xdd, 0x7e, 0x1f, 0x51, 0x18, 0x16, 0x7e, 0x6f, 0x97, 0xd8, 0x47, 0xe0, 0xd3, 0xbb, 0xef,
-    0xe5, 0x46, 0xe4, 0x8f, 0x5f, 0xfb, 0x8e, 0xe4, 0x3c, 0x1c, 0x19, 0xda, 0xfb, 0x03, 0x50, 0xe5,
-    0x98, 0x3a, 0x0a, 0xae, 0xaa, 0x9f, 0xca, 0x62, 0x10, 0x78, 0x7e, 0xe7, 0x54, 0x62, 0x3f, 0xc0,
-    0x6e, 0xbf, 0x8f, 0x30, 0x8c, 0x0a, 0xbf, 0x47, 0x75, 0x00, 0xaa, 0x91, 0x75, 0xc9, 0x70, 0xfd,
-    0x01, 0x14, 0x48, 0xd7, 0x01, 0x74, 0x45, 0x80, 0xf4, 0xc8, 0xd5, 0xe1, 0x0c, 0x65, 0x72, 0x1b,
-    0xdf, 0x1f, 0x40, 0x85, 0xf4, 0xb9, 0x80, 0xdd, 0x9d, 0x9d, 0x72, 0x07, 0xd8, 0xd9, 0xc9, 0xfd,
-    0xb7, 0x4f, 0xef, 0xbe, 0x17, 0x0b, 0xa3, 0xe8, 0x32, 0xba, 0x8c, 0x2c, 0x53, 0x38, 0x83, 0xd0,
-    0xe9, 0x92, 0x40, 0x26, 0xa6, 0x73, 0x80, 0xaa, 0x71, 0x0e, 0xc0, 0x64, 0x31, 0x08, 0xbc, 0xe5,
-    0x1b, 0xc9, 0x67, 0x01, 0x87, 0x0e, 0xa0, 0x27, 0x07, 0xa8, 0x9a, 0x4a, 0x2a, 0x81, 0x54, 0x1d,
-    0xb6, 0xf5, 0x53, 0x49, 0x17, 0x81, 0x74, 0x45, 0x00, 0x13, 0xe1, 0xbf, 0x4c, 0x87, 0x8b, 0x00,
-    0x0a, 0xa4, 0x72, 0x00, 0xef, 0x8f, 0xfb, 0xf7, 0x4b, 0xbf, 0xd3, 0xfd, 0xfb, 0x1f, 0xb3, 0x3f,
-    0x4a, 0x11, 0xf7, 0x34, 0x90, 0x89, 0xd8, 0x07, 0x30, 0x2e, 0x67, 0x03, 0x5d, 0x7f, 0x00, 0x26,
-    0x8b, 0x41, 0xe0, 0xf9, 0xf3, 0x73, 0x63, 0xb3, 0x27, 0xd0, 0x03, 0x10, 0x53, 0x6a, 0xec, 0x82,
-    0xb2, 0xc3, 0x19, 0x9c, 0x6d, 0xe1, 0x32, 0xb6, 0xf4, 0x2f, 0xdd, 0xbc, 0x39, 0x16, 0x86, 0x54,
-    0xa5, 0xb1, 0xfd, 0x01, 0x86, 0x49, 0x06, 0x5d, 0x7f, 0x80, 0x06, 0xb3, 0xec, 0xfb, 0xae, 0x3f,
-    0x80, 0xce, 0x6b, 0x47, 0x45, 0xbf, 0x60, 0x31, 0x08, 0x5c, 0x7f, 0x80, 0xa6, 0x33, 0x2e, 0xc6,
-    0x07, 0x9c, 0x03, 0x28, 0x91, 0x0a, 0xff, 0x71, 0xc9, 0xab, 0xd6, 0xb8, 0x42, 0x10, 0x93, 0x65,
-    0xdf, 0x3f, 0xec, 0x0f, 0x70, 0xf4, 0x48, 0xf8, 0xc3, 0x4e, 0x07, 0xbb, 0xfd, 0xfe, 0xe3, 0xd7,
-    0xce, 0x4e, 0xe2, 0x3d, 0xa5, 0x48, 0x64, 0x13, 0xd7, 0x1f, 0x80, 0x49, 0x7a, 0x3f, 0xc0, 0x9d,
-    0x9f, 0x56, 0x10, 0x85, 0x21, 0xc2, 0x30, 0x42, 0x14, 0x86, 0xd2, 0x2b, 0x2a, 0x2d, 0x0f, 0xd7,
-    0x01, 0x37, 0x05, 0x28, 0x30, 0x2e, 0x4b, 0x40, 0x80, 0x39, 0x05, 0x50, 0x46, 0xa1, 0xc9, 0x42,
-    0x90, 0x09, 0xfd, 0xc1, 0xea, 0x1a, 0xe9, 0x7a, 0x99, 0x46, 0x9f, 0x0e, 0xd6, 0xdd, 0x1f, 0x80,
-    0xbb, 0x2f, 0xcf, 0x76, 0x7f, 0x82, 0x41, 0x0e, 0xa0, 0xb1, 0x3f, 0x40, 0xd1, 0x1e, 0x3e, 0x53,
-    0x08, 0x9d, 0xae, 0x3f, 0x00, 0x93, 0xac, 0xfd, 0x00, 0xa3, 0x8c, 0xcb, 0x01, 0x14, 0x18, 0x97,
-    0xf0, 0x0f, 0x38, 0x07, 0x50, 0x62, 0x5c, 0xca, 0xc0, 0x80, 0xeb, 0x0f, 0xc0, 0x46, 0xe4, 0x00,
-    0x26, 0x9c, 0xa0, 0x8a, 0x5c, 0x20, 0xad, 0xc3, 0x15, 0x82, 0x98, 0x0c, 0xea, 0x00, 0x47, 0xd3,
-    0xc0, 0x1b, 0x57, 0x17, 0x0a, 0x0b, 0x41, 0x75, 0xdd, 0x09, 0x24, 0x70, 0x0e, 0xa0, 0x80, 0x5c,
-    0x07, 0x38, 0x3a, 0xee, 0x35, 0xb2, 0xb8, 0xfe, 0x00, 0x0a, 0xa4, 0xea, 0x00, 0x5a, 0x4f, 0xf2,
-    0xc8, 0x21, 0xda, 0xd4, 0xc1, 0x10, 0x59, 0xb6, 0xeb, 0x0f, 0xc0, 0x64, 0x90, 0x03, 0x18, 0xe8,
-    0x0f, 0x60, 0x6a, 0x57, 0x70, 0x91, 0x5c, 0xd7, 0x1f, 0x80, 0x89, 0xa8, 0x03, 0x98, 0x5a, 0x0a,
-    0x56, 0x7d, 0x38, 0xd4, 0xf5, 0x07, 0xa8, 0xd9, 0x71, 0xed, 0xaa, 0x61, 0x39, 0xc0, 0xb8, 0xc2,
-    0x74, 0xac, 0xb4, 0xc3, 0x94, 0xdd, 0xbf, 0x5a, 0x3b, 0x58, 0x0b, 0x00, 0x9e, 0xbb, 0x74, 0xc9,
-    0x8a, 0xf2, 0x87, 0x1b, 0x1b, 0xa8, 0x83, 0xfe, 0x61, 0x28, 0xeb, 0x45, 0xc0, 0x8d, 0x86, 0xbf,
-    0x5c, 0xbf, 0x9e, 0xeb, 0x50, 0xaf, 0x7e, 0xfb, 0x2d, 0xc9, 0x99, 0x38, 0x32, 0x06, 0x39, 0xc0,
-    0xbf, 0xff, 0x56, 0xbb, 0x5e, 0x3d, 0x77, 0xee, 0x7c, 0xe2, 0xbd, 0x6d, 0xfd, 0xaa, 0xe8, 0x4e,
-    0x5c, 0xa9, 0x46, 0xd6, 0x25, 0x23, 0xb1, 0x0a, 0x30, 0x65, 0x14, 0xaa, 0x5c, 0xdb, 0xfa, 0x6d,
-    0x93, 0x1e, 0xb9, 0x3a, 0x9c, 0xa1, 0x4c, 0xee, 0xb1, 0x3a, 0x80, 0x89, 0x9b, 0x23, 0xcb, 0x2c,
-    0x1b, 0x79, 0xb6, 0xf5, 0xdb, 0xe0, 0x97, 0xeb, 0xd7, 0x63, 0x61, 0x14, 0x5d, 0x46, 0x97, 0x91,
-    0x65, 0x0a, 0x67, 0x10, 0x3a, 0xdd, 0xc3, 0xa0, 0x86, 0xe3, 0x1c, 0xa0, 0xe1, 0x24, 0x1c, 0xa0,
-    0x8a, 0xb9, 0xb1, 0x48, 0x87, 0x6d, 0xfd, 0xb6, 0x31, 0x11, 0xfe, 0xcb, 0x74, 0xb8, 0x87, 0x41,
-    0x80, 0x47, 0x59, 0xaa, 0xa9, 0xec, 0x1d, 0x1c, 0x05, 0xdc, 0x14, 0xd0, 0x70, 0x94, 0x23, 0xc0,
-    0xc9, 0xd6, 0x44, 0xe2, 0xfd, 0x7e, 0x54, 0xed, 0x1e, 0x78, 0xdb, 0xfa, 0x05, 0x65, 0xcf, 0x1e,
-    0xea, 0x1e, 0x39, 0x3c, 0x00, 0xf1, 0x73, 0x97, 0x2e, 0x91, 0xe7, 0xc6, 0xf4, 0x8d, 0x4f, 0x43,
-    0x35, 0x84, 0x58, 0x8e, 0x3d, 0xdc, 0xd8, 0x80, 0x2d, 0xfd, 0x47, 0x95, 0xc0, 0x61, 0xe7, 0xdd,
-    0xd1, 0x2f, 0x05, 0x53, 0x29, 0xbb, 0xf9, 0xe2, 0x1a, 0x8a, 0x11, 0x54, 0x92, 0x31, 0x9d, 0xfa,
-    0x35, 0x52, 0x6b, 0x03, 0x97, 0xe1, 0x72, 0x80, 0x86, 0x43, 0x76, 0x00, 0xca, 0xe8, 0x53, 0xb9,
-    0x76, 0x54, 0xf4, 0x8f, 0x2b, 0x2e, 0x02, 0x34, 0x1c, 0x57, 0x07, 0x20, 0x26, 0xc1, 0x05, 0x49,
-    0x63, 0x73, 0x92, 0x40, 0xc7, 0x71, 0xca, 0xf6, 0x32, 0xe8, 0xd8, 0x73, 0x60, 0x12, 0xb2, 0x03,
-    0xec, 0x47, 0x21, 0x79, 0x6e, 0x35, 0x91, 0x85, 0xdb, 0xd6, 0x9f, 0x47, 0x9d, 0x4b, 0xcb, 0x14,
-    0x5c, 0x0e, 0xd0, 0x70, 0x58, 0x0e, 0x40, 0x19, 0x59, 0x9c, 0x42, 0x0c, 0xf7, 0xd9, 0xbc, 0x4e,
-    0xfd, 0x8e, 0x43, 0xd8, 0x11, 0x60, 0x3f, 0x0a, 0x33, 0x6f, 0x72, 0xde, 0xe7, 0x45, 0xa8, 0xcc,
-    0x8f, 0x3a, 0xf5, 0xd7, 0x85, 0xa2, 0x3d, 0x7c, 0xa6, 0x75, 0x2a, 0x27, 0x81, 0xb6, 0x6f, 0xb6,
-    0x6d, 0xfd, 0xe3, 0x82, 0xcb, 0x01, 0x1a, 0x8e, 0x5b, 0x06, 0x02, 0x1e, 0x65, 0x2a, 0xda, 0xde,
-    0xea, 0x55, 0xf0, 0x53, 0xaa, 0x27, 0x11, 0x01, 0xaa, 0xd8, 0x30, 0x59, 0xa4, 0xc3, 0xb6, 0x7e,
-    0xdb, 0x54, 0x91, 0x0b, 0xa4, 0x75, 0xb8, 0x08, 0x30, 0x24, 0x65, 0x0e, 0x55, 0xf7, 0xc8, 0xe1,
-    0x1c, 0x60, 0x48, 0xea, 0x5e, 0xe9, 0x2b, 0xe3, 0x98, 0x03, 0xc8, 0x1e, 0x6d, 0xea, 0x60, 0x06,
-    0xf5, 0x5a, 0x1b, 0xfa, 0x15, 0xd0, 0x7a, 0x92, 0x47, 0x0e, 0xd1, 0xa6, 0x0e, 0x86, 0xc8, 0xb2,
-    0xd9, 0x3b, 0x82, 0x74, 0x21, 0x3d, 0x5c, 0x61, 0xed, 0x08, 0x32, 0xa0, 0xbf, 0xd6, 0x0f, 0x6b,
-    0x4c, 0x33, 0x88, 0x00, 0xd4, 0x51, 0x42, 0x79, 0x6a, 0xa6, 0x82, 0x6d, 0xfd, 0x75, 0xa1, 0xea,
-    0xc3, 0xa1, 0xac, 0xe3, 0xe1, 0xcc, 0xc7, 0xa6, 0xda, 0x31, 0xa4, 0xdf, 0x45, 0x80, 0x86, 0x13,
-    0x3f, 0x3b, 0x33, 0x83, 0xcd, 0xad, 0xcd, 0xc2, 0x8b, 0xa6, 0x26, 0xa7, 0xf0, 0xd7, 0x9f, 0x7f,
-    0x02, 0x63, 0xe6, 0x30, 0x46, 0xfa, 0x03, 0x50, 0xe5, 0x99, 0xea, 0x0f, 0xc0, 0xd5, 0x1f, 0x46,
-    0x11, 0x0e, 0x0e, 0x0e, 0x0a, 0xaf, 0x0d, 0xa3, 0xe2, 0xff, 0x1a, 0x76, 0x54, 0xd1, 0xde, 0x1f,
-    0x80, 0x2a, 0xc7, 0xd4, 0x91, 0x6d, 0x15, 0xfd, 0x51, 0x18, 0x96, 0x3a, 0xc0, 0x28, 0xf4, 0xfe,
-    0x57, 0xc1, 0xf5, 0x07, 0x00, 0x10, 0x86, 0x21, 0xe2, 0xfd, 0x92, 0x08, 0xa0, 0xe0, 0x00, 0x2b,
-    0xb3, 0xb3, 0x31, 0x00, 0x2c, 0xac, 0xaf, 0xd7, 0x76, 0xda, 0x70, 0xfd, 0x01, 0xa0, 0x3f, 0x02,
-    0x08, 0xc3, 0x6f, 0x76, 0xbb, 0x89, 0xf7, 0x75, 0x74, 0x04, 0xf7, 0x34, 0x10, 0x8f, 0x73, 0x80,
-    0xa2, 0x17, 0x35, 0x07, 0x58, 0x99, 0x9d, 0x8d, 0x37, 0xbb, 0xdd, 0x81, 0xf1, 0x81, 0x43, 0x47,
-    0xd8, 0xec, 0x76, 0x07, 0x8e, 0x40, 0x95, 0xc3, 0xb9, 0x5e, 0x55, 0x8e, 0x73, 0x00, 0xc0, 0x8b,
-    0xc2, 0xd0, 0x3b, 0x38, 0x38, 0x28, 0x7c, 0x45, 0x61, 0xe8, 0xa1, 0xa2, 0x15, 0xc0, 0xca, 0xec,
-    0x6c, 0xdc, 0x8b, 0x22, 0xf4, 0xa2, 0x88, 0xe5, 0x34, 0x2a, 0x72, 0x5c, 0x7f, 0x00, 0x8d, 0x88,
-    0xd1, 0x9f, 0x07, 0x37, 0x0a, 0x00, 0x50, 0x76, 0x02, 0x61, 0xfc, 0x32, 0x5c, 0x04, 0xa8, 0x21,
-    0x0b, 0xeb, 0xeb, 0x5e, 0xbb, 0xf5, 0x38, 0x3d, 0xe3, 0x3a, 0x41, 0xda, 0xf8, 0xed, 0x56, 0x2b,
-    0x37, 0xff, 0x70, 0x0e, 0xa0, 0x91, 0x85, 0xf5, 0x75, 0x6f, 0x6a, 0x3a, 0xff, 0x3f, 0xb5, 0x9a,
-    0x9a, 0x9e, 0x26, 0x27, 0x82, 0xaa, 0x4e, 0xc0, 0x31, 0x3e, 0x30, 0x84, 0x03, 0x9c, 0x6c, 0x4d,
-    0x24, 0x5e, 0x55, 0x63, 0x5b, 0x7f, 0x15, 0x70, 0x9d, 0x80, 0x6b, 0x7c, 0xa0, 0x06, 0xfd, 0x01,
-    0x04, 0x16, 0xfb, 0x13, 0x68, 0x4f, 0xec, 0xd2, 0xcb, 0x40, 0x11, 0x15, 0x54, 0x97, 0x81, 0x14,
-    0xc3, 0xaa, 0x18, 0x1f, 0x60, 0x3a, 0x80, 0xed, 0x93, 0x39, 0x26, 0xf4, 0x6f, 0x6f, 0xf5, 0x8c,
-    0x65, 0xf6, 0x3a, 0xd7, 0xff, 0x45, 0x06, 0x56, 0x35, 0x3e, 0xe0, 0x1c, 0xc0, 0xa8, 0x03, 0xe8,
-    0x26, 0xcb, 0xd0, 0xc0, 0xe1, 0xd4, 0x20, 0x7f, 0xc6, 0x71, 0x38, 0xd7, 0x1f, 0x60, 0x84, 0xc8,
-    0xca, 0x09, 0x86, 0x31, 0x3e, 0xe0, 0x56, 0x01, 0x23, 0x47, 0xda, 0x09, 0x04, 0x2a, 0xc6, 0x07,
-    0xdc, 0x7e, 0x00, 0x20, 0x7f, 0x43, 0x0c, 0xf5, 0x66, 0x0e, 0xfb, 0x7d, 0xab, 0x34, 0x3e, 0x02,
-    0x3c, 0x3b, 0x33, 0x83, 0xa7, 0x2f, 0x5c, 0xc0, 0xb9, 0xf3, 0xe7, 0x71, 0xb6, 0xdd, 0xc6, 0xe9,
-    0xd3, 0xa7, 0xd1, 0x9a, 0xe0, 0x4d, 0x21, 0xcb, 0xbe, 0x8f, 0x8d, 0x8f, 0xae, 0x20, 0xec, 0xcd,
-    0xe2, 0xab, 0xbf, 0xde, 0x31, 0xf4, 0x4b, 0x0f, 0xc9, 0xab, 0xf0, 0xa9, 0x56, 0x0c, 0xc9, 0x0e,
-    0xc0, 0x49, 0xac, 0x4c, 0xf5, 0x07, 0x30, 0x71, 0xed, 0xe6, 0xd6, 0x26, 0xb6, 0xb7, 0x7b, 0xe8,
-    0xef, 0xf6, 0xf1, 0xdf, 0xde, 0x1e, 0xc2, 0x30, 0xc4, 0xc1, 0xfe, 0x3e, 0xeb, 0xb7, 0xbd, 0xf2,
-    0xfa, 0x0e, 0x66, 0x3e, 0x99, 0xc2, 0x37, 0xdb, 0x17, 0xf1, 0x03, 0x9e, 0x61, 0x7d, 0x97, 0x43,
-    0x56, 0x12, 0x38, 0x4c, 0xc5, 0x10, 0x70, 0x11, 0x40, 0x0b, 0xb2, 0xf1, 0xcf, 0x7c, 0xd6, 0x31,
-    0xa2, 0x23, 0x6f, 0xa9, 0x37, 0x6c, 0xd9, 0xd8, 0x7a, 0x7f, 0x00, 0x4e, 0x9f, 0x00, 0xdb, 0xfd,
-    0x09, 0xf2, 0x90, 0x8d, 0x7f, 0xe2, 0xe1, 0x43, 0x2d, 0x32, 0x65, 0xca, 0xd6, 0xf9, 0xc3, 0x38,
-    0x81, 0xf5, 0xfe, 0x00, 0xdc, 0x1d, 0xc4, 0xb6, 0xfb, 0x13, 0x64, 0x21, 0x1b, 0xff, 0xdc, 0x83,
-    0x9f, 0xb5, 0xc8, 0x14, 0x50, 0x8b, 0x3c, 0xaa, 0x4e, 0xd0, 0xf8, 0x83, 0x21, 0x67, 0xce, 0x3e,
-    0x35, 0xd8, 0xf4, 0x11, 0xef, 0x27, 0x36, 0x81, 0x58, 0x5f, 0x05, 0xa8, 0x54, 0xf8, 0x2a, 0x7b,
-    0x18, 0xe4, 0x18, 0xe0, 0xe5, 0xbc, 0x86, 0x42, 0xb5, 0xbc, 0xcb, 0x8d, 0x04, 0xce, 0x01, 0x6a,
-    0xc8, 0x30, 0xb5, 0x7d, 0x80, 0xe7, 0x04, 0xae, 0x3f, 0x40, 0xcd, 0x51, 0xad, 0xf0, 0xe5, 0x55,
-    0x0c, 0xd3, 0x34, 0x3e, 0x02, 0x4c, 0x4d, 0x4e, 0xe1, 0xec, 0xd9, 0x36, 0xce, 0x3c, 0x79, 0x06,
-    0xa7, 0x9e, 0x78, 0x02, 0x13, 0x13, 0x13, 0x38, 0x71, 0xf2, 0xa4, 0xd5, 0xdf, 0x24, 0x8c, 0xa7,
-    0x6a, 0x7c, 0x8e, 0x9c, 0xc6, 0x97, 0x82, 0x8f, 0x8e, 0x7b, 0xd5, 0x0e, 0x5d, 0x5b, 0xc8, 0xcb,
-    0xe4, 0xb8, 0xfe, 0x00, 0x23, 0x52, 0xb3, 0x37, 0x45, 0xc2, 0x01, 0x4c, 0x2d, 0xc5, 0xa8, 0x72,
-    0x6d, 0xeb, 0x6f, 0x22, 0xae, 0x3f, 0x40, 0xc3, 0x69, 0x01, 0xf4, 0x8a, 0x18, 0xf7, 0xd4, 0x2d,
-    0x15, 0xdb, 0xfa, 0x9b, 0xcc, 0xff, 0x4c, 0x4e, 0xba, 0xa2, 0xf0, 0x8d, 0x54, 0xbd, 0x00, 0x00,
-    0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+    0xcb, 0x00, 0x00, 0x06, 0x66, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0x9c, 0xcf, 0x6b, 0x5d,
+    0x45, 0x14, 0xc7, 0x2f, 0x21, 0x8d, 0x3e, 0x6b, 0xe2, 0x8f, 0x57, 0x4b, 0x8a, 0x51, 0x09, 0x92,
+    0xa2, 0xb6, 0x36, 0x10, 0x4b, 0x82, 0x60, 0x16, 0x16, 0x82, 0x50, 0x28, 0xd6, 0x65, 0x29, 0x62,
+    0x17, 0x15, 0x71, 0x63, 0x70, 0x9b, 0x7d, 0x41, 0xfc, 0x0f, 0x5c, 0xf8, 0x0f, 0x88, 0x7f, 0x81,
+    0xcb, 0xae, 0x5d, 0x96, 0x6e, 0xb2, 0x10, 0x17, 0xcd, 0x1f, 0xd0, 0x6d, 0x17, 0x23, 0x27, 0xed,
+    0x8d, 0xf7, 0xdd, 0xde, 0x37, 0x6f, 0xe6, 0xce, 0x99, 0x39, 0x33, 0x73, 0xbe, 0x03, 0x67, 0x91,
+    0x30, 0xb9, 0x87, 0xcc, 0xf9, 0xcc, 0xdc, 0x33, 0xe7, 0xc7, 0x6d, 0x9a, 0xa6, 0x31, 0x9a, 0xe5,
+    0xd9, 0xd3, 0xdd, 0x19, 0xf9, 0xe5, 0xe1, 0x77, 0x33, 0xd2, 0x0c, 0x8c, 0x9d, 0x2f, 0x3e, 0x3f,
+    0xfb, 0xfd, 0xc9, 0xc9, 0x89, 0xb1, 0x49, 0x53, 0xc0, 0x30, 0x47, 0x0f, 0x1e, 0x88, 0x48, 0x6b,
+    0x04, 0x49, 0xfd, 0xbe, 0x00, 0x90, 0xf1, 0x5b, 0xa1, 0x9f, 0x8f, 0x8f, 0x8f, 0x8d, 0x4d, 0x7c,
+    0x8d, 0xf1, 0xf8, 0xd1, 0x8f, 0x66, 0x9e, 0xc4, 0x7a, 0xc6, 0xe9, 0x62, 0x74, 0xff, 0xb1, 0x14,
+    0xd2, 0x07, 0x40, 0x4a, 0x7f, 0xe8, 0x09, 0x50, 0xc3, 0x38, 0x33, 0x40, 0x7f, 0x87, 0x70, 0x2e,
+    0x76, 0xff, 0xb9, 0x43, 0x00, 0x48, 0xe8, 0x1f, 0x03, 0x40, 0xac, 0x31, 0x76, 0xc7, 0x87, 0x3e,
+    0x77, 0x66, 0x51, 0x52, 0xec, 0x3c, 0x1b, 0x00, 0x02, 0xfa, 0xbd, 0x07, 0xf7, 0x09, 0xd0, 0x1a,
+    0x85, 0xd3, 0xe8, 0x3e, 0xba, 0x00, 0x80, 0xa7, 0xf1, 0xe9, 0x64, 0xe0, 0x84, 0x00, 0x00, 0x14,
+    0x76, 0x02, 0xfc, 0xb9, 0xb3, 0x53, 0xe7, 0x09, 0xa0, 0xd1, 0x09, 0xcc, 0xc1, 0x09, 0x4b, 0x61,
+    0x78, 0x9b, 0x4e, 0xd5, 0x00, 0xfc, 0xbe, 0xbd, 0x3d, 0x23, 0xbe, 0x3e, 0xc0, 0xc1, 0xc1, 0x81,
+    0xb1, 0x09, 0x00, 0xa8, 0x0c, 0x80, 0xd6, 0x07, 0x68, 0x5f, 0x03, 0xfb, 0xfb, 0xfb, 0xc6, 0x26,
+    0xd5, 0x02, 0xf0, 0xe5, 0xcd, 0x9b, 0x33, 0x92, 0x1a, 0x00, 0x2e, 0xfd, 0xa1, 0x27, 0x80, 0xba,
+    0x57, 0x40, 0x7f, 0xe1, 0xc7, 0x1a, 0xa2, 0x1b, 0x8d, 0x93, 0xd2, 0x3f, 0x16, 0x80, 0xda, 0x86,
+    0xb3, 0x01, 0x16, 0x2d, 0xfe, 0x98, 0xdd, 0x28, 0xa5, 0x3f, 0xa7, 0x38, 0x00, 0x00, 0x28, 0x08,
+    0x80, 0xbe, 0x0f, 0xa0, 0x06, 0x00, 0xd7, 0xc5, 0xf7, 0x85, 0x40, 0x4a, 0x7f, 0x4e, 0x71, 0x00,
+    0x00, 0x50, 0x18, 0x00, 0x2a, 0x7d, 0x00, 0x00, 0x30, 0x7c, 0x02, 0x98, 0x39, 0x63, 0x66, 0x81,
+    0x7b, 0x3f, 0x03, 0x80, 0x82, 0x01, 0x18, 0xca, 0x05, 0xcc, 0x33, 0xf8, 0x3c, 0x20, 0xe0, 0x04,
+    0x56, 0x76, 0x0b, 0x58, 0x64, 0x60, 0x00, 0x50, 0x19, 0x00, 0x43, 0x06, 0xb6, 0xed, 0xf6, 0x6a,
+    0x00, 0xa8, 0x31, 0x10, 0xc4, 0x71, 0x0b, 0x50, 0x73, 0x02, 0xd4, 0x18, 0x0a, 0x1e, 0x73, 0xfc,
+    0x77, 0x6b, 0x02, 0x39, 0x00, 0x40, 0x32, 0xa8, 0xb0, 0x74, 0x30, 0xf7, 0x09, 0x00, 0x00, 0x0a,
+    0xae, 0x07, 0x58, 0xf4, 0xee, 0x5f, 0xe4, 0x1f, 0x00, 0x80, 0x0a, 0x4e, 0x80, 0x6a, 0xb2, 0x81,
+    0x28, 0x09, 0x93, 0xc9, 0x05, 0xa0, 0x26, 0x10, 0x55, 0xc1, 0x00, 0xa0, 0x24, 0x00, 0x52, 0x18,
+    0x45, 0x0c, 0x00, 0x6d, 0x8d, 0x21, 0x39, 0x65, 0x03, 0xc5, 0x1b, 0x43, 0xe0, 0x04, 0x2a, 0xae,
+    0x07, 0x70, 0x15, 0xdf, 0xdd, 0xc6, 0xdd, 0x1c, 0x1a, 0x41, 0x7f, 0x56, 0xf5, 0x00, 0x22, 0xcd,
+    0xa1, 0xae, 0xe2, 0x6a, 0x80, 0x26, 0x52, 0x2b, 0x77, 0x24, 0xfd, 0xa8, 0x07, 0x00, 0x00, 0x41,
+    0xb7, 0x00, 0x73, 0x78, 0x74, 0x64, 0xae, 0xed, 0x5d, 0xb7, 0x0a, 0xcd, 0xc9, 0x15, 0x38, 0xbc,
+    0x02, 0x3c, 0x8f, 0xff, 0x5e, 0x3d, 0x80, 0xf9, 0xfe, 0xf0, 0xd0, 0x7c, 0xb2, 0xb3, 0x6d, 0x15,
+    0x9a, 0xe3, 0xa2, 0xaf, 0xdf, 0x9d, 0x3c, 0xa6, 0x53, 0xd9, 0xf7, 0x19, 0x70, 0x02, 0x03, 0x4f,
+    0x80, 0xbb, 0xf7, 0xef, 0x9b, 0xad, 0x4f, 0xaf, 0x58, 0x85, 0xe6, 0x64, 0x7d, 0x02, 0xe0, 0x1a,
+    0x38, 0x7e, 0xfd, 0xbe, 0xb9, 0x73, 0xc7, 0x6c, 0x7e, 0x74, 0xd9, 0x2a, 0x34, 0x67, 0x91, 0xbe,
+    0x58, 0xdf, 0x26, 0x58, 0xf4, 0x5c, 0x04, 0x82, 0x02, 0x4f, 0x80, 0xaf, 0x6e, 0xdd, 0x32, 0xef,
+    0x7d, 0xb8, 0x69, 0x15, 0x9a, 0x33, 0x4f, 0x5f, 0x6b, 0x94, 0x14, 0x1f, 0xa4, 0x18, 0xd2, 0x05,
+    0x00, 0x02, 0x7d, 0x80, 0xfd, 0x1b, 0x37, 0xcc, 0xa5, 0xf7, 0x37, 0xac, 0x42, 0x73, 0x00, 0x40,
+    0x9d, 0xdf, 0x07, 0x30, 0x9f, 0xed, 0xed, 0x99, 0x77, 0x2e, 0xad, 0x5b, 0x85, 0xe6, 0x64, 0x0f,
+    0x00, 0x9c, 0xc0, 0x71, 0x3e, 0xc0, 0xc7, 0x57, 0xaf, 0x9a, 0xb7, 0x2e, 0x4c, 0xad, 0x42, 0x73,
+    0x16, 0x01, 0x90, 0x72, 0x00, 0x80, 0x8c, 0xb2, 0x81, 0x00, 0xa0, 0x20, 0x00, 0xe8, 0xf8, 0xa7,
+    0xbf, 0xe7, 0x0c, 0x07, 0x17, 0x09, 0x80, 0xd6, 0xa2, 0x50, 0xf5, 0x27, 0x00, 0x77, 0x59, 0xb8,
+    0xef, 0x9d, 0x3f, 0x42, 0x59, 0x3a, 0x72, 0x01, 0x92, 0x8d, 0x21, 0x21, 0xbb, 0x9e, 0xa9, 0x31,
+    0x45, 0xfc, 0x04, 0x00, 0x00, 0x05, 0x01, 0xd0, 0xc6, 0x01, 0xf0, 0x7d, 0x80, 0xc4, 0x10, 0x44,
+    0x6c, 0x4e, 0xcd, 0xaa, 0x1e, 0x00, 0x00, 0x14, 0x00, 0x80, 0x4a, 0x1f, 0x00, 0x00, 0xcc, 0x8f,
+    0x04, 0x96, 0x5e, 0x70, 0x02, 0x00, 0x02, 0x72, 0x01, 0x54, 0xe8, 0x41, 0xb9, 0x7e, 0x4a, 0xf7,
+    0x52, 0xc6, 0x8f, 0x92, 0x3e, 0x14, 0xf7, 0xa7, 0xd0, 0xef, 0x8b, 0xe8, 0x1f, 0x9c, 0xc0, 0x9a,
+    0x6f, 0x01, 0x54, 0xed, 0x43, 0x05, 0x1f, 0x94, 0xf3, 0xa7, 0xb4, 0x2f, 0x65, 0xfe, 0x28, 0xf9,
+    0x43, 0xf1, 0x7f, 0x0a, 0x01, 0x03, 0x80, 0x0a, 0x01, 0xe8, 0x0e, 0x55, 0x00, 0x20, 0x10, 0xf4,
+    0xb2, 0x0f, 0xa0, 0x0e, 0x00, 0xed, 0xa1, 0xe0, 0xbe, 0x0f, 0xc0, 0x01, 0x00, 0x92, 0x41, 0x05,
+    0x77, 0x07, 0x03, 0x00, 0xe5, 0xf5, 0x00, 0x00, 0x00, 0x27, 0x40, 0x3d, 0x00, 0xa0, 0x24, 0xcc,
+    0x3f, 0x17, 0xc0, 0x09, 0x00, 0x6a, 0x02, 0x0b, 0xac, 0x0a, 0xe6, 0x08, 0x04, 0x01, 0x80, 0xb2,
+    0xbf, 0x0f, 0x10, 0x1c, 0x0a, 0xce, 0x0a, 0x00, 0x34, 0x86, 0xc8, 0x65, 0x03, 0xc5, 0x1b, 0x43,
+    0xe0, 0x04, 0x2a, 0xae, 0x07, 0x40, 0x73, 0x68, 0x1e, 0xf5, 0x00, 0x22, 0xcd, 0xa1, 0x0d, 0xda,
+    0xc3, 0x75, 0xd7, 0x03, 0x68, 0x17, 0x4f, 0xb0, 0xd8, 0x9d, 0x40, 0x71, 0x00, 0x3e, 0xd8, 0xdc,
+    0x14, 0x91, 0x76, 0x91, 0xa4, 0xf5, 0x87, 0x00, 0xe0, 0xf0, 0x9a, 0xf1, 0x1a, 0x7f, 0xdf, 0xbb,
+    0x67, 0xe6, 0x49, 0xac, 0x67, 0x9c, 0x2e, 0xc6, 0xea, 0x1b, 0x6b, 0x49, 0xa5, 0x0f, 0x80, 0xa4,
+    0xfe, 0x10, 0x00, 0x6a, 0x28, 0x39, 0x3b, 0x33, 0x40, 0x7f, 0x87, 0x70, 0x2e, 0x76, 0xff, 0xb9,
+    0x43, 0x00, 0x48, 0xe9, 0xcf, 0x05, 0x80, 0xb1, 0x3b, 0x3e, 0xf4, 0xb9, 0x33, 0x8b, 0x92, 0x62,
+    0xe7, 0xd9, 0x00, 0x90, 0xd0, 0x2f, 0x0d, 0x40, 0x6b, 0x14, 0x4e, 0xa3, 0xfb, 0xe8, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x81, 0xe2, 0x00, 0xa4, 0x1c, 0x00, 0xe0, 0x7f, 0xfd, 0x41,
+    0x03, 0x00, 0x00, 0x00, 0x9d, 0x00, 0xbc, 0x39, 0x9d, 0xce, 0x48, 0x6a, 0x00, 0x18, 0xf5, 0x07,
+    0x0d, 0x8e, 0x40, 0x50, 0x51, 0x00, 0xf4, 0x17, 0x7e, 0xac, 0x21, 0xba, 0xd1, 0x38, 0x29, 0xfd,
+    0xb9, 0xd4, 0x03, 0x64, 0x13, 0x08, 0x0a, 0x5d, 0xfc, 0x31, 0xbb, 0x51, 0x4a, 0x3f, 0x23, 0x00,
+    0xe5, 0x27, 0x83, 0x00, 0x00, 0x00, 0x60, 0x5b, 0x7c, 0x5f, 0x08, 0xa4, 0xf4, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xfb, 0x2d, 0xc4, 0x02, 0x8c, 0x0e, 0x27, 0x10, 0x00, 0x0c, 0x03, 0xe0,
+    0x50, 0x73, 0x00, 0x27, 0x30, 0x73, 0x27, 0x30, 0x08, 0x00, 0x87, 0xff, 0x0f, 0x00, 0x00, 0x80,
+    0x4a, 0x00, 0xa8, 0x34, 0x10, 0x04, 0x00, 0x94, 0x87, 0x82, 0xc5, 0x01, 0x40, 0x32, 0xa8, 0x00,
+    0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x83, 0x5f, 0x1e, 0x55, 0x01, 0xa0, 0xb4, 0x24, 0x2c,
+    0x1b, 0x00, 0x50, 0x13, 0x58, 0x20, 0x00, 0x1c, 0x81, 0x20, 0x00, 0x50, 0x30, 0x00, 0x1c, 0xa1,
+    0xe0, 0xac, 0x00, 0x50, 0xd8, 0x18, 0x92, 0xcd, 0x10, 0x6f, 0x0c, 0x81, 0x13, 0xa8, 0x38, 0x1b,
+    0xe8, 0x2a, 0xbe, 0xbb, 0x8d, 0xbb, 0x39, 0x34, 0x82, 0xfe, 0x26, 0xe7, 0x53, 0x20, 0x49, 0x73,
+    0xa8, 0xab, 0x78, 0xde, 0x97, 0xd9, 0x25, 0x92, 0x7e, 0x9c, 0x00, 0xca, 0x01, 0x30, 0xef, 0x6e,
+    0x6c, 0x98, 0xf3, 0xab, 0xaf, 0x5b, 0x85, 0xe6, 0xd4, 0x0a, 0x8c, 0xf6, 0x57, 0x80, 0xb9, 0xb8,
+    0xbe, 0x6e, 0x26, 0xe7, 0x5f, 0xb3, 0x0a, 0xcd, 0xa9, 0x1a, 0x00, 0xcd, 0xa1, 0xe0, 0xb7, 0xa7,
+    0x53, 0xf3, 0xca, 0xe4, 0x55, 0xab, 0xd0, 0x9c, 0xea, 0x01, 0xd0, 0xfa, 0x7d, 0x80, 0xd5, 0xb5,
+    0x35, 0xb3, 0xb2, 0xb2, 0x62, 0x15, 0x9a, 0xe3, 0x0b, 0xc0, 0x5f, 0xbb, 0xbb, 0x86, 0xa4, 0x28,
+    0x00, 0x34, 0x76, 0x07, 0x4f, 0x26, 0x13, 0xb3, 0xbc, 0xbc, 0x6c, 0x15, 0x9a, 0xe3, 0x0a, 0x40,
+    0x6b, 0xf8, 0x3f, 0xb6, 0xb6, 0x4e, 0x25, 0x77, 0x10, 0xd4, 0x03, 0xb0, 0x7c, 0xee, 0x9c, 0x59,
+    0x5a, 0x5a, 0xb2, 0x0a, 0xcd, 0x71, 0x01, 0xa0, 0x6b, 0xf8, 0xbe, 0xf8, 0x40, 0xc0, 0x05, 0x8d,
+    0xcb, 0x73, 0x10, 0x0a, 0x66, 0x1c, 0x1c, 0x00, 0xd0, 0x3c, 0xfa, 0x16, 0x21, 0x49, 0x08, 0x04,
+    0xae, 0xcf, 0x41, 0x24, 0x30, 0x81, 0xf1, 0x7d, 0x20, 0xe8, 0x1a, 0x6e, 0x2c, 0x04, 0x3e, 0xcf,
+    0x00, 0x00, 0x99, 0x01, 0x10, 0x0a, 0x81, 0xef, 0xdf, 0x02, 0x80, 0xcc, 0x5e, 0x01, 0x21, 0x10,
+    0x8c, 0xf9, 0x1b, 0x7c, 0x1f, 0x20, 0x53, 0x00, 0x7c, 0x0d, 0x3a, 0xf6, 0xd4, 0x10, 0x2d, 0x0b,
+    0xf7, 0xbd, 0xf3, 0x47, 0x28, 0x4b, 0x6f, 0x62, 0x40, 0xc0, 0x79, 0x0d, 0x74, 0x31, 0x6c, 0xc8,
+    0x2b, 0x43, 0xb4, 0x31, 0x24, 0x64, 0xd7, 0x33, 0x35, 0xa6, 0x44, 0x1b, 0x9c, 0xf7, 0x7f, 0x9b,
+    0x81, 0x43, 0x9d, 0x46, 0x00, 0x50, 0xc8, 0x18, 0x32, 0x34, 0xc7, 0x8d, 0x41, 0xb4, 0x39, 0x94,
+    0xdb, 0xf8, 0x23, 0x9a, 0x53, 0x9b, 0x92, 0x21, 0x08, 0x35, 0x3e, 0x00, 0x28, 0x70, 0x0c, 0x41,
+    0x10, 0xf2, 0xaa, 0xd1, 0x0e, 0x40, 0x68, 0xa1, 0x48, 0xf2, 0x42, 0x13, 0x00, 0xc0, 0xa8, 0x9f,
+    0x0a, 0x3d, 0x28, 0xd7, 0x4f, 0xe9, 0x5e, 0xca, 0xf8, 0x9d, 0x26, 0x86, 0x9e, 0xc7, 0xfd, 0x9d,
+    0xd7, 0x8f, 0x0c, 0xf0, 0xcf, 0xcf, 0x97, 0xcd, 0xb3, 0xa7, 0xbb, 0xe6, 0xb7, 0x27, 0xb7, 0xa3,
+    0x02, 0x20, 0xf6, 0x0a, 0xa8, 0xd5, 0x09, 0xa4, 0x6a, 0x1f, 0x2a, 0xf8, 0xa0, 0x9c, 0x3f, 0xa5,
+    0x7d, 0x29, 0xf3, 0x47, 0xc9, 0x1f, 0x9f, 0xf5, 0xeb, 0x1a, 0xff, 0xf6, 0x93, 0x1f, 0xa2, 0x01,
+    0x20, 0xea, 0x04, 0x02, 0x80, 0xf9, 0xeb, 0xd7, 0x35, 0xfe, 0xdd, 0x9f, 0xfe, 0x8d, 0x16, 0x60,
+    0x12, 0xbf, 0x06, 0xd6, 0x18, 0x08, 0xe2, 0x00, 0xa0, 0x6b, 0xfc, 0x6f, 0xbf, 0x7e, 0x18, 0x25,
+    0xc7, 0x90, 0x45, 0x20, 0xa8, 0xc6, 0x50, 0x30, 0x07, 0x00, 0x5d, 0xe3, 0x1f, 0x5e, 0xf9, 0x95,
+    0x15, 0x80, 0xec, 0x42, 0xc1, 0xb5, 0x25, 0x83, 0x38, 0x00, 0x88, 0x75, 0x0b, 0xc8, 0x3a, 0x19,
+    0x04, 0x00, 0xd2, 0x47, 0xfd, 0x90, 0x0e, 0x56, 0x02, 0x80, 0x58, 0x41, 0x88, 0xc6, 0x92, 0xb0,
+    0xdc, 0x01, 0x48, 0x5a, 0x12, 0xa6, 0x11, 0x00, 0x86, 0x40, 0x50, 0xd6, 0x99, 0x44, 0x14, 0x85,
+    0x3a, 0xe8, 0x6f, 0x94, 0xf7, 0x0c, 0xe2, 0xfb, 0x00, 0xca, 0x07, 0x6a, 0x02, 0x01, 0x00, 0xbe,
+    0x0f, 0xa0, 0x1a, 0x80, 0x06, 0xdf, 0x07, 0x50, 0x3b, 0xfe, 0x03, 0xa2, 0xf9, 0x23, 0xd7, 0x82,
+    0x69, 0x0a, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
 };
 #endif
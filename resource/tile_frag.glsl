@@ -0,0 +1,137 @@
+#version 440
+
+layout(binding = 0, std140) uniform screen_info {
+    uvec2 size;
+} screen;
+
+// A view move, evaluated for the current time so the whole move is one write
+layout(binding = 1, std140) uniform translation_info {
+    vec2 start;
+    vec2 target;
+    float start_scale;
+    float target_scale;
+    float start_time;
+    float duration;
+    // Seconds on the same clock as the start time, written with the frame
+    float time;
+} translation;
+
+layout(binding = 0) uniform sampler2DArray image;
+// One byte per grid cell, see 'room_state'
+layout(binding = 2) uniform usampler2D room_state;
+uniform vec2 layer_scale[4];
+
+// Room sprites indexed by paths and visited like 'textures::mapped_rooms'
+uniform vec4 room_sprites[32];
+uniform uint room_transforms[32];
+// Avoid, important 1 and important 2 marker sprites
+uniform vec4 marker_sprites[3];
+// Visited, transition, unvisited and end path sprites, down then right
+uniform vec4 path_sprites[8];
+
+layout(location = 0) out vec4 out_color;
+
+const int map_radius = 200;
+const float room_area = 40.0;
+
+const uint state_visited = 0x10u;
+const uint state_known = 0x80u;
+
+const uint rot_0 = 0u;
+const uint flip_vert = 4u;
+const uint flip_hori = 5u;
+
+const int border_begin = 8;
+const int border_length = 32;
+
+const vec2 uv_rotations[] = vec2[](
+vec2(0, 0), vec2(1, 0), vec2(0, 1), vec2(1, 1), // Rotation 0
+vec2(1, 0), vec2(1, 1), vec2(0, 0), vec2(0, 1), // Rotation 90
+vec2(1, 1), vec2(0, 1), vec2(1, 0), vec2(0, 0), // Rotation 180
+vec2(0, 1), vec2(0, 0), vec2(1, 1), vec2(1, 0), // Rotation 270
+vec2(0, 1), vec2(1, 1), vec2(0, 0), vec2(1, 0), // Flip Verticaly
+vec2(1, 0), vec2(0, 0), vec2(1, 1), vec2(0, 1)  // Flip Horizontaily
+);
+
+uint
+state(ivec2 cell) {
+    cell += map_radius;
+    if (any(lessThan(cell, ivec2(0))) || any(greaterThan(cell, ivec2(map_radius * 2)))) return 0u;
+    return texelFetch(room_state, cell, 0).r;
+}
+
+vec4
+sprite_color(vec4 sprite, uint transform, vec2 uv) {
+    // Every transform is affine so the corners of the table give the whole mapping
+    vec2 corner = uv_rotations[transform * 4u];
+    vec2 u = uv_rotations[transform * 4u + 1u] - corner;
+    vec2 v = uv_rotations[transform * 4u + 2u] - corner;
+    vec2 position = sprite.xy + sprite.zw * (corner + u * uv.x + v * uv.y);
+    return textureLod(image, vec3(position * layer_scale[0], 0.0), 0.0);
+}
+
+vec4
+path_color(uint from, uint to, uint from_door, uint to_door, int sprites, uint flip, vec2 uv) {
+    if ((from & state_known) != 0u) {
+        if ((from & from_door) == 0u) return vec4(0.0);
+        if ((to & state_known) == 0u) return sprite_color(path_sprites[sprites + 3], rot_0, uv);
+        if ((to & to_door) == 0u) return vec4(0.0);
+
+        bool visited = (from & to & state_visited) != 0u;
+        bool other = (to & state_visited) != 0u;
+        bool one_visited = ((from | to) & state_visited) != 0u;
+        int sprite = visited ? 0 : one_visited ? 1 : 2;
+        return sprite_color(path_sprites[sprites + sprite], one_visited && other ? flip : rot_0, uv);
+    }
+    // Doors out of a known room into an unknown one end in the gap
+    if ((to & state_known) != 0u && (to & to_door) != 0u) return sprite_color(path_sprites[sprites + 3], flip, uv);
+    return vec4(0.0);
+}
+
+// Eased out like 'update' on the CPU
+float
+view_progress() {
+    float t = translation.duration > 0.0 ? clamp((translation.time - translation.start_time) / translation.duration, 0.0, 1.0) : 1.0;
+    return 1.0 - pow(1.0 - t, 3.0);
+}
+
+void main() {
+    // Inverse of the translation in the rect vertex shader
+    vec2 pixel = vec2(2.0 / float(screen.size.x), -2.0 / float(screen.size.y));
+    vec2 screen_position = gl_FragCoord.xy / vec2(screen.size) * 2.0 - 1.0;
+    float progress = view_progress();
+    float scale = mix(translation.start_scale, translation.target_scale, progress);
+    vec2 position = (screen_position / scale - vec2(-1, 1)) / pixel - mix(translation.start, translation.target, progress);
+
+    // Each cell covers its room and the gaps below and right of it
+    ivec2 cell = ivec2(floor((position + 16.0) / room_area));
+    vec2 local = position - vec2(cell) * room_area;
+    uint here = state(cell);
+
+    vec4 color = vec4(0.0);
+    if (local.x < 16.0 && local.y < 16.0) {
+        if ((here & state_known) == 0u) discard;
+        uint index = here & 0x1Fu;
+        vec2 uv = (local + 16.0) / 32.0;
+        color = sprite_color(room_sprites[index], room_transforms[index], uv);
+
+        uint marker = (here >> 5) & 0x3u;
+        if (marker != 0u) {
+            vec4 overlay = sprite_color(marker_sprites[marker - 1u], room_transforms[index], uv);
+            color = vec4(mix(color.rgb, overlay.rgb, overlay.a), overlay.a + color.a * (1.0 - overlay.a));
+        }
+    } else if (local.y >= 16.0 && local.x >= -6.0 && local.x < 10.0) {
+        color = path_color(here, state(cell + ivec2(0, 1)), 0x1u, 0x4u, 0, flip_vert, (local - vec2(-6.0, 16.0)) / vec2(16.0, 8.0));
+    } else if (local.x >= 16.0 && local.y >= -6.0 && local.y < 10.0) {
+        color = path_color(here, state(cell + ivec2(1, 0)), 0x2u, 0x8u, 4, flip_hori, (local - vec2(16.0, -6.0)) / vec2(8.0, 16.0));
+    }
+    if (color.a == 0.0) discard;
+
+    ivec2 s = ivec2(screen.size) / 2;
+    ivec2 p = ivec2(abs(screen_position * vec2(screen.size) * 0.5));
+    vec2 n = clamp(p - s + (border_begin + border_length).xx, 0, border_length);
+    float q = max(n.x, n.y);
+    color.a *= 1 - (q / float(border_length));
+
+    out_color = color;
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#ifndef _TILE_FRAG_H
+#define _TILE_FRAG_H
+
+inline constexpr char tile_frag[] {
+        "#version 440\n"
+        "\n"
+        "layout(binding = 0, std140) uniform screen_info {\n"
+        "    uvec2 size;\n"
+        "} screen;\n"
+        "\n"
+        "// A view move, evaluated for the current time so the whole move is one write\n"
+        "layout(binding = 1, std140) uniform translation_info {\n"
+        "    vec2 start;\n"
+        "    vec2 target;\n"
+        "    float start_scale;\n"
+        "    float target_scale;\n"
+        "    float start_time;\n"
+        "    float duration;\n"
+        "    // Seconds on the same clock as the start time, written with the frame\n"
+        "    float time;\n"
+        "} translation;\n"
+        "\n"
+        "layout(binding = 0) uniform sampler2DArray image;\n"
+        "// One byte per grid cell, see 'room_state'\n"
+        "layout(binding = 2) uniform usampler2D room_state;\n"
+        "uniform vec2 layer_scale[4];\n"
+        "\n"
+        "// Room sprites indexed by paths and visited like 'textures::mapped_rooms'\n"
+        "uniform vec4 room_sprites[32];\n"
+        "uniform uint room_transforms[32];\n"
+        "// Avoid, important 1 and important 2 marker sprites\n"
+        "uniform vec4 marker_sprites[3];\n"
+        "// Visited, transition, unvisited and end path sprites, down then right\n"
+        "uniform vec4 path_sprites[8];\n"
+        "\n"
+        "layout(location = 0) out vec4 out_color;\n"
+        "\n"
+        "const int map_radius = 200;\n"
+        "const float room_area = 40.0;\n"
+        "\n"
+        "const uint state_visited = 0x10u;\n"
+        "const uint state_known = 0x80u;\n"
+        "\n"
+        "const uint rot_0 = 0u;\n"
+        "const uint flip_vert = 4u;\n"
+        "const uint flip_hori = 5u;\n"
+        "\n"
+        "const int border_begin = 8;\n"
+        "const int border_length = 32;\n"
+        "\n"
+        "const vec2 uv_rotations[] = vec2[](\n"
+        "vec2(0, 0), vec2(1, 0), vec2(0, 1), vec2(1, 1), // Rotation 0\n"
+        "vec2(1, 0), vec2(1, 1), vec2(0, 0), vec2(0, 1), // Rotation 90\n"
+        "vec2(1, 1), vec2(0, 1), vec2(1, 0), vec2(0, 0), // Rotation 180\n"
+        "vec2(0, 1), vec2(0, 0), vec2(1, 1), vec2(1, 0), // Rotation 270\n"
+        "vec2(0, 1), vec2(1, 1), vec2(0, 0), vec2(1, 0), // Flip Verticaly\n"
+        "vec2(1, 0), vec2(0, 0), vec2(1, 1), vec2(0, 1)  // Flip Horizontaily\n"
+        ");\n"
+        "\n"
+        "uint\n"
+        "state(ivec2 cell) {\n"
+        "    cell += map_radius;\n"
+        "    if (any(lessThan(cell, ivec2(0))) || any(greaterThan(cell, ivec2(map_radius * 2)))) return 0u;\n"
+        "    return texelFetch(room_state, cell, 0).r;\n"
+        "}\n"
+        "\n"
+        "vec4\n"
+        "sprite_color(vec4 sprite, uint transform, vec2 uv) {\n"
+        "    // Every transform is affine so the corners of the table give the whole mapping\n"
+        "    vec2 corner = uv_rotations[transform * 4u];\n"
+        "    vec2 u = uv_rotations[transform * 4u + 1u] - corner;\n"
+        "    vec2 v = uv_rotations[transform * 4u + 2u] - corner;\n"
+        "    vec2 position = sprite.xy + sprite.zw * (corner + u * uv.x + v * uv.y);\n"
+        "    return textureLod(image, vec3(position * layer_scale[0], 0.0), 0.0);\n"
+        "}\n"
+        "\n"
+        "vec4\n"
+        "path_color(uint from, uint to, uint from_door, uint to_door, int sprites, uint flip, vec2 uv) {\n"
+        "    if ((from & state_known) != 0u) {\n"
+        "        if ((from & from_door) == 0u) return vec4(0.0);\n"
+        "        if ((to & state_known) == 0u) return sprite_color(path_sprites[sprites + 3], rot_0, uv);\n"
+        "        if ((to & to_door) == 0u) return vec4(0.0);\n"
+        "\n"
+        "        bool visited = (from & to & state_visited) != 0u;\n"
+        "        bool other = (to & state_visited) != 0u;\n"
+        "        bool one_visited = ((from | to) & state_visited) != 0u;\n"
+        "        int sprite = visited ? 0 : one_visited ? 1 : 2;\n"
+        "        return sprite_color(path_sprites[sprites + sprite], one_visited && other ? flip : rot_0, uv);\n"
+        "    }\n"
+        "    // Doors out of a known room into an unknown one end in the gap\n"
+        "    if ((to & state_known) != 0u && (to & to_door) != 0u) return sprite_color(path_sprites[sprites + 3], flip, uv);\n"
+        "    return vec4(0.0);\n"
+        "}\n"
+        "\n"
+        "// Eased out like 'update' on the CPU\n"
+        "float\n"
+        "view_progress() {\n"
+        "    float t = translation.duration > 0.0 ? clamp((translation.time - translation.start_time) / translation.duration, 0.0, 1.0) : 1.0;\n"
+        "    return 1.0 - pow(1.0 - t, 3.0);\n"
+        "}\n"
+        "\n"
+        "void main() {\n"
+        "    // Inverse of the translation in the rect vertex shader\n"
+        "    vec2 pixel = vec2(2.0 / float(screen.size.x), -2.0 / float(screen.size.y));\n"
+        "    vec2 screen_position = gl_FragCoord.xy / vec2(screen.size) * 2.0 - 1.0;\n"
+        "    float progress = view_progress();\n"
+        "    float scale = mix(translation.start_scale, translation.target_scale, progress);\n"
+        "    vec2 position = (screen_position / scale - vec2(-1, 1)) / pixel - mix(translation.start, translation.target, progress);\n"
+        "\n"
+        "    // Each cell covers its room and the gaps below and right of it\n"
+        "    ivec2 cell = ivec2(floor((position + 16.0) / room_area));\n"
+        "    vec2 local = position - vec2(cell) * room_area;\n"
+        "    uint here = state(cell);\n"
+        "\n"
+        "    vec4 color = vec4(0.0);\n"
+        "    if (local.x < 16.0 && local.y < 16.0) {\n"
+        "        if ((here & state_known) == 0u) discard;\n"
+        "        uint index = here & 0x1Fu;\n"
+        "        vec2 uv = (local + 16.0) / 32.0;\n"
+        "        color = sprite_color(room_sprites[index], room_transforms[index], uv);\n"
+        "\n"
+        "        uint marker = (here >> 5) & 0x3u;\n"
+        "        if (marker != 0u) {\n"
+        "            vec4 overlay = sprite_color(marker_sprites[marker - 1u], room_transforms[index], uv);\n"
+        "            color = vec4(mix(color.rgb, overlay.rgb, overlay.a), overlay.a + color.a * (1.0 - overlay.a));\n"
+        "        }\n"
+        "    } else if (local.y >= 16.0 && local.x >= -6.0 && local.x < 10.0) {\n"
+        "        color = path_color(here, state(cell + ivec2(0, 1)), 0x1u, 0x4u, 0, flip_vert, (local - vec2(-6.0, 16.0)) / vec2(16.0, 8.0));\n"
+        "    } else if (local.x >= 16.0 && local.y >= -6.0 && local.y < 10.0) {\n"
+        "        color = path_color(here, state(cell + ivec2(1, 0)), 0x2u, 0x8u, 4, flip_hori, (local - vec2(16.0, -6.0)) / vec2(8.0, 16.0));\n"
+        "    }\n"
+        "    if (color.a == 0.0) discard;\n"
+        "\n"
+        "    ivec2 s = ivec2(screen.size) / 2;\n"
+        "    ivec2 p = ivec2(abs(screen_position * vec2(screen.size) * 0.5));\n"
+        "    vec2 n = clamp(p - s + (border_begin + border_length).xx, 0, border_length);\n"
+        "    float q = max(n.x, n.y);\n"
+        "    color.a *= 1 - (q / float(border_length));\n"
+        "\n"
+        "    out_color = color;\n"
+        "}"
+};
+
+#endif //_TILE_FRAG_H
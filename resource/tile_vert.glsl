@@ -0,0 +1,7 @@
+#version 440
+
+// One triangle covering the screen, the fragment shader finds the room under each pixel
+void main() {
+    vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    gl_Position = vec4(corner * 2.0 - 1.0, 0.0, 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,14 @@
+#ifndef _TILE_VERT_H
+#define _TILE_VERT_H
+
+inline constexpr char tile_vert[] {
+        "#version 440\n"
+        "\n"
+        "// One triangle covering the screen, the fragment shader finds the room under each pixel\n"
+        "void main() {\n"
+        "    vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);\n"
+        "    gl_Position = vec4(corner * 2.0 - 1.0, 0.0, 1.0);\n"
+        "}"
+};
+
+#endif //_TILE_VERT_H
@@ -26,6 +26,14 @@ enum class path_flag : unsigned {
 enum class uv_translation : unsigned int {
     rot_0, rot_90, rot_180, rot_270, flip_vert, flip_hori
 };
+// Layers of the texture array
+enum class texture_layer : unsigned {
+    texture, background, compass, help
+};
+// Timers of the frame profiler, the GPU stages of 'render' come first
+enum class profile_timer : unsigned {
+    background, map, paths, markers, overlays, present, update, map_instances, find_path, render
+};
 enum class room_flag {
     none = 0,
     
@@ -50,10 +58,17 @@ typedef unsigned int large_bool;
 struct screen_info {
     [[maybe_unused]] glm::uvec2 size { 0 };
 };
+// A view move from start to target, the shaders evaluate it for the current time
 struct translation_info {
-    [[maybe_unused]] glm::vec2 position { 0 };
-    [[maybe_unused]] glm::uint scale = 0;
-    [[maybe_unused]] large_bool enabled = false;
+    [[maybe_unused]] glm::vec2 start { 0 };
+    [[maybe_unused]] glm::vec2 target { 0 };
+    [[maybe_unused]] float start_scale = 0;
+    [[maybe_unused]] float target_scale = 0;
+    [[maybe_unused]] float start_time = 0;
+    [[maybe_unused]] float duration = 0;
+    [[maybe_unused]] float time = 0;
+    // std140 rounds the block up to a whole vec4
+    [[maybe_unused]] float padding[3] { };
 };
 
 struct quad {
@@ -69,6 +84,37 @@ struct rect {
     [[maybe_unused]] quad dimensions { { 0, 0 }, { 0, 0 } };
     [[maybe_unused]] uv_quad texture { { 0, 0 }, { 0, 0 } };
     [[maybe_unused]] uv_translation uv_tr = uv_translation::rot_0;
+    // Texture layer, translation and border fade, filled in when the rect is drawn
+    [[maybe_unused]] texture_layer layer = texture_layer::texture;
+    [[maybe_unused]] unsigned flags = 0;
+};
+
+// Packed form of a 'rect' streamed to the GPU, the size and texture come from the sprite table
+struct rect_instance {
+    [[maybe_unused]] std::int16_t x = 0;
+    [[maybe_unused]] std::int16_t y = 0;
+    [[maybe_unused]] std::uint16_t sprite = 0;
+    [[maybe_unused]] std::uint8_t uv_tr = 0;
+    // Not read when drawing, the draw's flags select the program variant instead
+    [[maybe_unused]] std::uint8_t flags = 0;
+};
+static_assert(sizeof(rect_instance) == 8);
+
+// Sprite table entry, std140 layout
+struct sprite_data {
+    [[maybe_unused]] uv_quad texture { { 0, 0 }, { 0, 0 } };
+    [[maybe_unused]] glm::uvec2 size { 0 };
+    [[maybe_unused]] texture_layer layer = texture_layer::texture;
+    [[maybe_unused]] unsigned padding = 0;
+};
+
+// Layout of 'glMultiDrawElementsIndirect' commands
+struct draw_command {
+    [[maybe_unused]] unsigned count = 0;
+    [[maybe_unused]] unsigned instance_count = 0;
+    [[maybe_unused]] unsigned first_index = 0;
+    [[maybe_unused]] int base_vertex = 0;
+    [[maybe_unused]] unsigned base_instance = 0;
 };
 
 inline constexpr path_flag
@@ -87,30 +133,56 @@ struct room_data {
     bool visited = false;
 };
 
+struct player_data {
+    glm::ivec2 position { 0, 0 };
+    
+    std::pair<glm::ivec2, path_flag> path[10] { { { 0, 0 }, (path_flag) 0 } };
+    unsigned path_head = 0;
+    unsigned path_size = 0;
+    
+    std::vector<glm::ivec2> portal_path;
+};
+
 struct astar_point {
     glm::ivec2 position { 0, 0 };
-    std::vector<glm::ivec2> parent_dir;
+    glm::ivec2 parent_dir { 0, 0 };
     unsigned path_length = 0;
-    unsigned heuristic = 0;
+    unsigned cost = 0;
+    bool closed = false;
     
     astar_point( ) noexcept = default;
     
-    astar_point(const glm::ivec2& position, std::initializer_list<glm::ivec2> parent_dir, unsigned path_length, unsigned heuristic) :
-            position(position), parent_dir(parent_dir), path_length(path_length), heuristic(heuristic) { }
+    astar_point(const glm::ivec2& position, const glm::ivec2& parent_dir, unsigned path_length, unsigned cost) :
+            position(position), parent_dir(parent_dir), path_length(path_length), cost(cost) { }
+};
+struct corridor_edge {
+    point_id_t junction = (point_id_t) 0;
+    unsigned cost = 0;
+    std::vector<glm::ivec2> steps;
 };
+struct corridor_label {
+    unsigned cost = 0;
+    unsigned path_length = 0;
+    const corridor_edge* edge = nullptr;
+    point_id_t parent = (point_id_t) 0;
+    bool closed = false;
+};
+
 struct queued_point {
     unsigned heuristic = 0;
+    unsigned cost = 0;
     point_id_t point = (point_id_t) 0;
     
     queued_point( ) noexcept = default;
     
-    queued_point(unsigned int heuristic, point_id_t point) :
-            heuristic(heuristic), point(point) { }
+    queued_point(unsigned int heuristic, unsigned int cost, point_id_t point) :
+            heuristic(heuristic), cost(cost), point(point) { }
 };
 
+// Ties go to the point furthest along its route so equal estimates do not flood the search
 [[nodiscard]] inline constexpr bool
 operator<(const queued_point& left, const queued_point& right) {
-    return left.heuristic > right.heuristic;
+    return left.heuristic > right.heuristic || (left.heuristic == right.heuristic && left.cost < right.cost);
 }
 
 #endif //_TYPES_HPP